@@ -36,6 +36,8 @@ namespace iroha_cli {
              "Transaction has successfully passed stateful validation."},
             {iroha::protocol::TxStatus::COMMITTED,
              "Transaction was successfully committed."},
+            {iroha::protocol::TxStatus::ORDERING_REJECTED,
+             "Ordering service is overloaded, send transaction later."},
             {iroha::protocol::TxStatus::NOT_RECEIVED,
              "Transaction was not found in the system."}};
 
@@ -65,9 +65,8 @@ namespace iroha {
                                 return false;
                               });
         };
-        return std::all_of(transaction.commands().begin(),
-                           transaction.commands().end(),
-                           execute_command);
+        const auto &commands = transaction.commands();
+        return std::all_of(commands.begin(), commands.end(), execute_command);
       };
 
       *sql_ << "SAVEPOINT savepoint_";
@@ -0,0 +1,67 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/peer_query_cache.hpp"
+
+#include <algorithm>
+
+#include "common/visitor.hpp"
+#include "interfaces/commands/command.hpp"
+#include "interfaces/iroha_internal/block.hpp"
+
+namespace iroha {
+  namespace ametsuchi {
+
+    namespace {
+      /**
+       * @return true if block changes the peer list of the ledger
+       */
+      bool addsPeer(const shared_model::interface::Block &block) {
+        const auto &transactions = block.transactions();
+        return std::any_of(
+            transactions.begin(), transactions.end(), [](const auto &tx) {
+              const auto &commands = tx.commands();
+              return std::any_of(
+                  commands.begin(), commands.end(), [](const auto &command) {
+                    return visit_in_place(
+                        command.get(),
+                        [](const shared_model::interface::AddPeer &) {
+                          return true;
+                        },
+                        [](const auto &) { return false; });
+                  });
+            });
+      }
+    }  // namespace
+
+    PeerQueryCache::PeerQueryCache(
+        std::shared_ptr<PeerQuery> source,
+        rxcpp::observable<std::shared_ptr<shared_model::interface::Block>>
+            commits)
+        : source_(std::move(source)) {
+      subscription_ = commits.subscribe([this](const auto &block) {
+        if (addsPeer(*block)) {
+          std::lock_guard<std::mutex> lock(mutex_);
+          peers_ = boost::none;
+        }
+      });
+    }
+
+    PeerQueryCache::~PeerQueryCache() {
+      subscription_.unsubscribe();
+    }
+
+    boost::optional<std::vector<PeerQuery::wPeer>>
+    PeerQueryCache::getLedgerPeers() {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (not peers_) {
+        // failed fetch is not cached, so it is retried on next request
+        peers_ = source_->getLedgerPeers();
+      }
+      return peers_;
+    }
+
+  }  // namespace ametsuchi
+}  // namespace iroha
@@ -0,0 +1,57 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_PEER_QUERY_CACHE_HPP
+#define IROHA_PEER_QUERY_CACHE_HPP
+
+#include "ametsuchi/peer_query.hpp"
+
+#include <mutex>
+
+#include <rxcpp/rx.hpp>
+
+namespace shared_model {
+  namespace interface {
+    class Block;
+  }  // namespace interface
+}  // namespace shared_model
+
+namespace iroha {
+  namespace ametsuchi {
+
+    /**
+     * Implementation of PeerQuery which keeps peers of the ledger in memory.
+     * Peers are fetched from the source on first request and once again after
+     * a block with AddPeer command is committed
+     */
+    class PeerQueryCache : public PeerQuery {
+     public:
+      /**
+       * @param source - query which provides peers to the cache
+       * @param commits - blocks committed to the ledger
+       */
+      PeerQueryCache(
+          std::shared_ptr<PeerQuery> source,
+          rxcpp::observable<std::shared_ptr<shared_model::interface::Block>>
+              commits);
+
+      ~PeerQueryCache() override;
+
+      /**
+       * Fetch peers stored in ledger
+       * @return list of peers in insertion to ledger order
+       */
+      boost::optional<std::vector<wPeer>> getLedgerPeers() override;
+
+     private:
+      std::shared_ptr<PeerQuery> source_;
+      std::mutex mutex_;
+      boost::optional<std::vector<wPeer>> peers_;
+      rxcpp::composite_subscription subscription_;
+    };
+
+  }  // namespace ametsuchi
+}  // namespace iroha
+#endif  // IROHA_PEER_QUERY_CACHE_HPP
@@ -6,12 +6,14 @@
 #include "ametsuchi/impl/storage_impl.hpp"
 
 #include <soci/postgresql/soci-postgresql.h>
+#include <algorithm>
 #include <boost/format.hpp>
 
 #include "ametsuchi/impl/flat_file/flat_file.hpp"
 #include "ametsuchi/impl/mutable_storage_impl.hpp"
 #include "ametsuchi/impl/postgres_block_query.hpp"
 #include "ametsuchi/impl/postgres_wsv_query.hpp"
+#include "ametsuchi/impl/soci_utils.hpp"
 #include "ametsuchi/impl/temporary_wsv_impl.hpp"
 #include "backend/protobuf/permissions.hpp"
 #include "converters/protobuf/json_proto_converter.hpp"
@@ -276,11 +278,178 @@ WHERE pg_stat_activity.datname = :dbname
             stringToBytes(shared_model::converters::protobuf::modelToJson(
                 *std::static_pointer_cast<shared_model::proto::Block>(
                     block.second))));
-        notifier_.get_subscriber().on_next(block.second);
       }
 
       *(storage->sql_) << "COMMIT";
       storage->committed = true;
+
+      // subscribers are notified when state of the blocks is visible in wsv
+      for (const auto &block : storage->block_store_) {
+        notifier_.get_subscriber().on_next(block.second);
+      }
+    }
+
+    namespace {
+      /**
+       * Tables which form the state of the storage, in order in which they
+       * can be filled without violation of foreign keys
+       */
+      const std::vector<std::string> kSnapshotTables = {
+          "role",
+          "domain",
+          "signatory",
+          "account",
+          "account_has_signatory",
+          "peer",
+          "asset",
+          "account_has_asset",
+          "role_has_permissions",
+          "account_has_roles",
+          "account_has_grantable_permissions",
+          "height_by_hash",
+          "height_by_account_set",
+          "index_by_creator_height",
+          "index_by_id_height_asset"};
+
+      /**
+       * Rollback transaction after a failure, connection may be already
+       * broken, so errors are only logged
+       */
+      void rollback(soci::session &sql, const logger::Logger &log) {
+        try {
+          sql << "ROLLBACK";
+        } catch (const std::exception &e) {
+          log->error("Failed to rollback: {}", e.what());
+        }
+      }
+    }  // namespace
+
+    boost::optional<WsvSnapshot> StorageImpl::createSnapshot() const {
+      std::shared_lock<std::shared_timed_mutex> lock(drop_mutex);
+      if (connection_ == nullptr) {
+        log_->warn("Tried to create snapshot without active connection");
+        return boost::none;
+      }
+      soci::session sql(*connection_);
+      try {
+        // all tables are read from the same state of the database
+        sql << "BEGIN TRANSACTION ISOLATION LEVEL REPEATABLE READ READ ONLY";
+
+        WsvSnapshot snapshot;
+        long long height;
+        sql << "SELECT COALESCE(MAX(height::bigint), 0) FROM height_by_hash",
+            soci::into(height);
+        snapshot.height = height;
+
+        for (const auto &name : kSnapshotTables) {
+          WsvTable table{name, {}};
+          soci::indicator ind;
+          std::string row;
+          // rows are sorted byte-wise, so the order does not depend on locale
+          soci::statement st =
+              (sql.prepare << "SELECT row_to_json(t)::text AS r FROM " + name
+                       + " t ORDER BY r COLLATE \"C\"",
+               soci::into(row, ind));
+          st.execute();
+          processSoci(st, ind, row, [&table](std::string &r) {
+            table.rows.push_back(std::move(r));
+          });
+          snapshot.tables.push_back(std::move(table));
+        }
+
+        sql << "COMMIT";
+        return snapshot;
+      } catch (const std::exception &e) {
+        log_->error("Failed to create snapshot: {}", e.what());
+        rollback(sql, log_);
+        return boost::none;
+      }
+    }
+
+    bool StorageImpl::loadSnapshot(
+        const WsvSnapshot &snapshot,
+        const std::vector<std::shared_ptr<shared_model::interface::Block>>
+            &blocks) {
+      std::shared_lock<std::shared_timed_mutex> lock(drop_mutex);
+      if (connection_ == nullptr) {
+        log_->warn("Tried to load snapshot without active connection");
+        return false;
+      }
+
+      auto height = block_store_->last_id();
+      for (const auto &block : blocks) {
+        if (block->height() != ++height) {
+          log_->error("Block {} does not follow block store", block->height());
+          return false;
+        }
+      }
+      if (height != snapshot.height) {
+        log_->error("Blocks end at {}, while snapshot is at {}",
+                    height,
+                    snapshot.height);
+        return false;
+      }
+
+      // table names come from the network, so only known ones are accepted
+      std::vector<const WsvTable *> tables;
+      for (const auto &name : kSnapshotTables) {
+        auto it = std::find_if(
+            snapshot.tables.begin(),
+            snapshot.tables.end(),
+            [&name](const auto &table) { return table.name == name; });
+        if (it == snapshot.tables.end()) {
+          log_->error("Snapshot has no table {}", name);
+          return false;
+        }
+        tables.push_back(&*it);
+      }
+      if (tables.size() != snapshot.tables.size()) {
+        log_->error("Snapshot has unknown tables");
+        return false;
+      }
+
+      soci::session sql(*connection_);
+      try {
+        sql << "BEGIN";
+        sql << reset_;
+        for (const auto *table : tables) {
+          std::string row;
+          soci::statement st =
+              (sql.prepare << "INSERT INTO " + table->name
+                       + " SELECT * FROM json_populate_record(NULL::"
+                       + table->name + ", (:row)::json)",
+               soci::use(row));
+          for (const auto &r : table->rows) {
+            row = r;
+            st.execute(true);
+          }
+        }
+        // serial column continues after the loaded rows
+        sql << "SELECT setval(pg_get_serial_sequence("
+               "'index_by_creator_height', 'id'), "
+               "COALESCE(MAX(id), 0) + 1, false) FROM index_by_creator_height";
+
+        // blocks are written before the state, so if commit fails, block
+        // store is still consistent and the state is restored from it
+        for (const auto &block : blocks) {
+          auto json = shared_model::converters::protobuf::modelToJson(
+              *std::static_pointer_cast<shared_model::proto::Block>(block));
+          if (not block_store_->add(block->height(), stringToBytes(json))) {
+            log_->error("Failed to store block {}", block->height());
+            rollback(sql, log_);
+            return false;
+          }
+        }
+
+        sql << "COMMIT";
+      } catch (const std::exception &e) {
+        log_->error("Failed to load snapshot: {}", e.what());
+        rollback(sql, log_);
+        return false;
+      }
+
+      log_->info("Snapshot at height {} is loaded", snapshot.height);
+      return true;
     }
 
     namespace {
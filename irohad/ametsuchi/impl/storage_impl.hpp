@@ -82,6 +82,13 @@ namespace iroha {
 
       std::shared_ptr<BlockQuery> getBlockQuery() const override;
 
+      boost::optional<WsvSnapshot> createSnapshot() const override;
+
+      bool loadSnapshot(
+          const WsvSnapshot &snapshot,
+          const std::vector<std::shared_ptr<shared_model::interface::Block>>
+              &blocks) override;
+
       rxcpp::observable<std::shared_ptr<shared_model::interface::Block>>
       on_commit() override;
 
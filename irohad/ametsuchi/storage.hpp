@@ -6,10 +6,12 @@
 #ifndef IROHA_AMETSUCHI_H
 #define IROHA_AMETSUCHI_H
 
+#include <boost/optional.hpp>
 #include <rxcpp/rx-observable.hpp>
 #include <vector>
 #include "ametsuchi/mutable_factory.hpp"
 #include "ametsuchi/temporary_factory.hpp"
+#include "ametsuchi/wsv_snapshot.hpp"
 #include "common/result.hpp"
 
 namespace shared_model {
@@ -51,6 +53,24 @@ namespace iroha {
           const std::vector<std::shared_ptr<shared_model::interface::Block>>
               &blocks) = 0;
 
+      /**
+       * Dump current state of the storage in one transaction
+       * @return snapshot at the height of the top block, none on failure
+       */
+      virtual boost::optional<WsvSnapshot> createSnapshot() const = 0;
+
+      /**
+       * Replace current state with the snapshot and append blocks, which
+       * lead to it, without applying them. Blocks must follow the top block
+       * @param snapshot - state after the last of the blocks
+       * @param blocks - blocks from the top one up to the snapshot height
+       * @return true if snapshot is loaded
+       */
+      virtual bool loadSnapshot(
+          const WsvSnapshot &snapshot,
+          const std::vector<std::shared_ptr<shared_model::interface::Block>>
+              &blocks) = 0;
+
       /**
        * method called when block is written to the storage
        * @return observable with the Block committed
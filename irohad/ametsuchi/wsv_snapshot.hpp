@@ -0,0 +1,38 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_WSV_SNAPSHOT_HPP
+#define IROHA_WSV_SNAPSHOT_HPP
+
+#include <string>
+#include <vector>
+
+#include "interfaces/common_objects/types.hpp"
+
+namespace iroha {
+  namespace ametsuchi {
+
+    /**
+     * Rows of one table of the storage
+     */
+    struct WsvTable {
+      std::string name;
+      /// rows as json objects, sorted so that equal tables are equal
+      std::vector<std::string> rows;
+    };
+
+    /**
+     * Full state of the storage after the block with given height, including
+     * indices of the blocks
+     */
+    struct WsvSnapshot {
+      shared_model::interface::types::HeightType height;
+      std::vector<WsvTable> tables;
+    };
+
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_WSV_SNAPSHOT_HPP
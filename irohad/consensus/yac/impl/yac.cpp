@@ -92,33 +92,36 @@ namespace iroha {
 
       // ------|Network notifications|------
 
+      // signatures are verified before taking the lock, so messages from
+      // different peers are checked concurrently
+
       void Yac::on_vote(VoteMessage vote) {
-        std::lock_guard<std::mutex> guard(mutex_);
-        if (crypto_->verify(vote)) {
-          applyVote(findPeer(vote), vote);
-        } else {
+        if (not crypto_->verify(vote)) {
           log_->warn(cryptoError({vote}));
+          return;
         }
+        std::lock_guard<std::mutex> guard(mutex_);
+        applyVote(findPeer(vote), vote);
       }
 
       void Yac::on_commit(CommitMessage commit) {
-        std::lock_guard<std::mutex> guard(mutex_);
-        if (crypto_->verify(commit)) {
-          // Commit does not contain data about peer which sent the message
-          applyCommit(boost::none, commit);
-        } else {
+        if (not crypto_->verify(commit)) {
           log_->warn(cryptoError(commit.votes));
+          return;
         }
+        std::lock_guard<std::mutex> guard(mutex_);
+        // Commit does not contain data about peer which sent the message
+        applyCommit(boost::none, commit);
       }
 
       void Yac::on_reject(RejectMessage reject) {
-        std::lock_guard<std::mutex> guard(mutex_);
-        if (crypto_->verify(reject)) {
-          // Reject does not contain data about peer which sent the message
-          applyReject(boost::none, reject);
-        } else {
+        if (not crypto_->verify(reject)) {
           log_->warn(cryptoError(reject.votes));
+          return;
         }
+        std::lock_guard<std::mutex> guard(mutex_);
+        // Reject does not contain data about peer which sent the message
+        applyReject(boost::none, reject);
       }
 
       // ------|Private interface|------
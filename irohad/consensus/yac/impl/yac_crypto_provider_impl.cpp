@@ -23,31 +23,79 @@
 namespace iroha {
   namespace consensus {
     namespace yac {
+      namespace {
+        // peers send several votes per round, limits keep a few hundred
+        // rounds of a large network
+        const uint32_t kVerifiedVotesHigh = 20000;
+        const uint32_t kVerifiedVotesLow = 15000;
+
+        /**
+         * @param vote - vote to be signed or verified
+         * @return blob with the data signed by the vote
+         */
+        shared_model::crypto::Blob makeVoteBlob(const VoteMessage &vote) {
+          return shared_model::crypto::Blob(
+              PbConverters::serializeVote(vote).hash().SerializeAsString());
+        }
+
+        /**
+         * @param blob - signed data of the vote
+         * @param vote - vote for which key is created
+         * @return key of the vote in verified votes cache
+         */
+        std::string makeVerifiedKey(const shared_model::crypto::Blob &blob,
+                                    const VoteMessage &vote) {
+          return shared_model::crypto::toBinaryString(blob)
+              + shared_model::crypto::toBinaryString(
+                     vote.signature->publicKey())
+              + shared_model::crypto::toBinaryString(
+                     vote.signature->signedData());
+        }
+      }  // namespace
+
       CryptoProviderImpl::CryptoProviderImpl(
           const shared_model::crypto::Keypair &keypair)
-          : keypair_(keypair) {}
+          : keypair_(keypair),
+            verified_votes_(kVerifiedVotesHigh, kVerifiedVotesLow) {}
+
+      bool CryptoProviderImpl::verifyVotes(
+          const std::vector<VoteMessage> &votes) {
+        // blobs are referenced by batch items, so they must not be moved
+        std::vector<shared_model::crypto::Blob> blobs;
+        blobs.reserve(votes.size());
+        std::vector<std::string> keys;
+        shared_model::crypto::VerificationBatch batch;
+        for (const auto &vote : votes) {
+          blobs.push_back(makeVoteBlob(vote));
+          auto key = makeVerifiedKey(blobs.back(), vote);
+          if (verified_votes_.findItem(key)) {
+            continue;
+          }
+          keys.push_back(std::move(key));
+          batch.push_back({vote.signature->signedData(),
+                           blobs.back(),
+                           vote.signature->publicKey()});
+        }
+
+        if (not shared_model::crypto::CryptoVerifier<>::verifyAll(batch)) {
+          return false;
+        }
+        for (const auto &key : keys) {
+          verified_votes_.addItem(key, true);
+        }
+        return true;
+      }
 
       bool CryptoProviderImpl::verify(CommitMessage msg) {
-        return std::all_of(
-            std::begin(msg.votes),
-            std::end(msg.votes),
-            [this](const auto &vote) { return this->verify(vote); });
+        return verifyVotes(msg.votes);
       }
 
       bool CryptoProviderImpl::verify(RejectMessage msg) {
-        return std::all_of(
-            std::begin(msg.votes),
-            std::end(msg.votes),
-            [this](const auto &vote) { return this->verify(vote); });
+        return verifyVotes(msg.votes);
       }
 
       bool CryptoProviderImpl::verify(VoteMessage msg) {
-        auto serialized =
-            PbConverters::serializeVote(msg).hash().SerializeAsString();
-        auto blob = shared_model::crypto::Blob(serialized);
-
-        return shared_model::crypto::CryptoVerifier<>::verify(
-            msg.signature->signedData(), blob, msg.signature->publicKey());
+        return verifyVotes({msg});
       }
 
       VoteMessage CryptoProviderImpl::getVote(YacHash hash) {
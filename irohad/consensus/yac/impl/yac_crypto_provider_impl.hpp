@@ -19,6 +19,8 @@
 #define IROHA_YAC_CRYPTO_PROVIDER_IMPL_HPP
 
 #include "consensus/yac/yac_crypto_provider.hpp"
+
+#include "cache/cache.hpp"
 #include "cryptography/keypair.hpp"
 
 namespace iroha {
@@ -38,7 +40,21 @@ namespace iroha {
         VoteMessage getVote(YacHash hash) override;
 
        private:
+        /**
+         * Verify signatures of votes which were not verified before
+         * @param votes - votes to be checked
+         * @return true if all signatures are correct
+         */
+        bool verifyVotes(const std::vector<VoteMessage> &votes);
+
         shared_model::crypto::Keypair keypair_;
+
+        /**
+         * Votes with correct signatures, so the same vote received inside
+         * commit or reject is not verified again. Key is concatenation of
+         * serialized vote hash, public key and signature
+         */
+        cache::Cache<std::string, bool> verified_votes_;
       };
     }  // namespace yac
   }    // namespace consensus
@@ -27,6 +27,7 @@
 #include "consensus/yac/yac_peer_orderer.hpp"
 #include "cryptography/public_key.hpp"
 #include "interfaces/common_objects/signature.hpp"
+#include "metrics/round_metrics.hpp"
 #include "network/block_loader.hpp"
 #include "simulator/block_creator.hpp"
 
@@ -54,6 +55,7 @@ namespace iroha {
 
       void YacGateImpl::vote(
           const shared_model::interface::BlockVariant &block) {
+        metrics::PhaseTimer vote_timer(metrics::Phase::kVote, block.height());
         auto hash = hash_provider_->makeHash(block);
         log_->info("vote for block ({}, {})",
                    hash.proposal_hash,
@@ -61,9 +63,14 @@ namespace iroha {
         auto order = orderer_->getOrdering(hash);
         if (not order) {
           log_->error("ordering doesn't provide peers => pass round");
+          vote_timer.cancel();
           return;
         }
         current_block_ = std::make_pair(hash, block);
+        vote_timer.stop();
+        voted_at_ = std::chrono::steady_clock::now();
+        metrics::PhaseTimer propagation_timer(metrics::Phase::kPropagation,
+                                              block.height());
         hash_gate_->vote(hash, *order);
       }
 
@@ -82,6 +89,11 @@ namespace iroha {
             }
             // if node has voted for the committed block
             if (hash == current_block_.first) {
+              metrics::roundMetrics().record(
+                  metrics::Phase::kSupermajority,
+                  current_block_.second.height(),
+                  std::chrono::duration_cast<std::chrono::microseconds>(
+                      std::chrono::steady_clock::now() - voted_at_));
               // append signatures of other nodes
               this->copySignatures(commit_message);
               log_->info("consensus: commit top block: height {}, hash {}",
@@ -18,6 +18,7 @@
 #ifndef IROHA_YAC_GATE_IMPL_HPP
 #define IROHA_YAC_GATE_IMPL_HPP
 
+#include <chrono>
 #include <memory>
 #include <rxcpp/rx-observable.hpp>
 
@@ -77,6 +78,8 @@ namespace iroha {
 
         std::pair<YacHash, shared_model::interface::BlockVariant>
             current_block_;
+        /// time of vote for current block
+        std::chrono::steady_clock::time_point voted_at_;
       };
 
     }  // namespace yac
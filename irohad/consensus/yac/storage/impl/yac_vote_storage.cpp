@@ -18,22 +18,17 @@
 #include "consensus/yac/storage/yac_vote_storage.hpp"
 
 #include <algorithm>
+#include <tuple>
 #include <utility>
 
-#include "consensus/yac/storage/yac_proposal_storage.hpp"
-
 namespace iroha {
   namespace consensus {
     namespace yac {
 
       // --------| private api |--------
 
-      auto YacVoteStorage::getProposalStorage(ProposalHash hash) {
-        return std::find_if(proposal_storages_.begin(),
-                            proposal_storages_.end(),
-                            [&hash](auto storage) {
-                              return storage.getProposalHash() == hash;
-                            });
+      auto YacVoteStorage::getProposalStorage(const ProposalHash &hash) {
+        return proposal_storages_.find(hash);
       }
 
       auto YacVoteStorage::findProposalStorage(const VoteMessage &msg,
@@ -42,18 +37,30 @@ namespace iroha {
         if (val != proposal_storages_.end()) {
           return val;
         }
-        return proposal_storages_.emplace(
-            proposal_storages_.end(),
-            msg.hash.proposal_hash,
-            peers_in_round,
-            std::make_shared<SupermajorityCheckerImpl>());
+        rounds_.push_back(msg.hash.proposal_hash);
+        return proposal_storages_
+            .emplace(std::piecewise_construct,
+                     std::forward_as_tuple(msg.hash.proposal_hash),
+                     std::forward_as_tuple(
+                         msg.hash.proposal_hash,
+                         peers_in_round,
+                         std::make_shared<SupermajorityCheckerImpl>()))
+            .first;
       }
 
       // --------| public api |--------
 
+      YacVoteStorage::YacVoteStorage(size_t retained_rounds,
+                                     size_t evicted_rounds)
+          : retained_rounds_(retained_rounds),
+            evicted_rounds_(evicted_rounds) {}
+
       boost::optional<Answer> YacVoteStorage::store(VoteMessage vote,
                                                      uint64_t peers_in_round) {
-        return findProposalStorage(vote, peers_in_round)->insert(vote);
+        if (isEvicted(vote.hash.proposal_hash)) {
+          return boost::none;
+        }
+        return findProposalStorage(vote, peers_in_round)->second.insert(vote);
       }
 
       boost::optional<Answer> YacVoteStorage::store(CommitMessage commit,
@@ -67,19 +74,20 @@ namespace iroha {
       }
 
       bool YacVoteStorage::isHashCommitted(ProposalHash hash) {
-        auto iter = getProposalStorage(std::move(hash));
+        auto iter = getProposalStorage(hash);
         if (iter == proposal_storages_.end()) {
           return false;
         }
-        return bool(iter->getState());
+        return bool(iter->second.getState());
       }
 
       bool YacVoteStorage::getProcessingState(const ProposalHash &hash) {
-        return processing_state_.count(hash) != 0;
+        return processing_state_.count(hash) != 0 or isEvicted(hash);
       }
 
       void YacVoteStorage::markAsProcessedState(const ProposalHash &hash) {
         processing_state_.insert(hash);
+        evictPreceding(hash);
       }
 
       // --------| private api |--------
@@ -90,8 +98,45 @@ namespace iroha {
           return boost::none;
         }
 
+        if (isEvicted(votes.at(0).hash.proposal_hash)) {
+          return boost::none;
+        }
         auto storage = findProposalStorage(votes.at(0), peers_in_round);
-        return storage->insert(votes);
+        return storage->second.insert(votes);
+      }
+
+      void YacVoteStorage::evictPreceding(const ProposalHash &hash) {
+        // processed round is usually the latest one, so search from the back
+        auto round = std::find(rounds_.rbegin(), rounds_.rend(), hash);
+        if (round == rounds_.rend()) {
+          return;
+        }
+        auto preceding =
+            static_cast<size_t>(std::distance(round, rounds_.rend())) - 1;
+        if (preceding <= retained_rounds_) {
+          return;
+        }
+        auto evicted_end = rounds_.begin() + (preceding - retained_rounds_);
+        std::for_each(
+            rounds_.begin(), evicted_end, [this](const auto &evicted) {
+              proposal_storages_.erase(evicted);
+              processing_state_.erase(evicted);
+              // late messages would recreate the storage and the round would
+              // be processed again
+              if (evicted_.insert(evicted).second) {
+                evicted_order_.push_back(evicted);
+              }
+            });
+        rounds_.erase(rounds_.begin(), evicted_end);
+
+        while (evicted_order_.size() > evicted_rounds_) {
+          evicted_.erase(evicted_order_.front());
+          evicted_order_.pop_front();
+        }
+      }
+
+      bool YacVoteStorage::isEvicted(const ProposalHash &hash) const {
+        return evicted_.count(hash) != 0;
       }
 
     }  // namespace yac
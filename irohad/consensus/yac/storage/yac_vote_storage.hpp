@@ -20,20 +20,24 @@
 
 #include <memory>
 #include <boost/optional.hpp>
+#include <deque>
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
 #include "consensus/yac/messages.hpp"  // because messages passed by value
 #include "consensus/yac/storage/storage_result.hpp"  // for Answer
 #include "consensus/yac/storage/yac_common.hpp"      // for ProposalHash
+#include "consensus/yac/storage/yac_proposal_storage.hpp"
 
 namespace iroha {
   namespace consensus {
     namespace yac {
-      class YacProposalStorage;
-
       /**
        * Class provide storage for votes and useful methods for it.
+       * Storage keeps only a limited number of rounds preceding the last
+       * processed one. Hashes of older rounds are remembered as processed, so
+       * that late messages for them are not stored again
        */
       class YacVoteStorage {
        private:
@@ -44,7 +48,7 @@ namespace iroha {
          * @param hash - object for finding
          * @return iterator to proposal storage
          */
-        auto getProposalStorage(ProposalHash hash);
+        auto getProposalStorage(const ProposalHash &hash);
 
         /**
          * Find existed proposal storage or create new if required
@@ -60,11 +64,28 @@ namespace iroha {
        public:
         // --------| public api |--------
 
+        /// default number of rounds retained before the last processed one
+        static constexpr size_t kDefaultRetainedRounds = 10;
+
+        /// default number of evicted rounds which are remembered
+        static constexpr size_t kDefaultEvictedRounds = 1000;
+
+        /**
+         * @param retained_rounds - number of rounds preceding the last
+         * processed round which are kept in storage
+         * @param evicted_rounds - number of the latest evicted rounds for
+         * which messages are refused
+         */
+        explicit YacVoteStorage(
+            size_t retained_rounds = kDefaultRetainedRounds,
+            size_t evicted_rounds = kDefaultEvictedRounds);
+
         /**
          * Insert vote in storage
          * @param msg - current vote message
          * @param peers_in_round - number of peers participated in round
-         * @return structure with result of inserting. Nullopt if mgs not valid.
+         * @return structure with result of inserting. Nullopt if mgs not valid
+         * or its round was evicted.
          */
         boost::optional<Answer> store(VoteMessage msg,
                                        uint64_t peers_in_round);
@@ -74,7 +95,7 @@ namespace iroha {
          * @param commit - message with votes
          * @param peers_in_round - number of peers in current consensus round
          * @return structure with result of inserting.
-         * Nullopt if commit not valid.
+         * Nullopt if commit not valid or its round was evicted.
          */
         boost::optional<Answer> store(CommitMessage commit,
                                        uint64_t peers_in_round);
@@ -84,7 +105,7 @@ namespace iroha {
          * @param reject - message with votes
          * @param peers_in_round - number of peers in current consensus round
          * @return structure with result of inserting.
-         * Nullopt if reject not valid.
+         * Nullopt if reject not valid or its round was evicted.
          */
         boost::optional<Answer> store(RejectMessage reject,
                                        uint64_t peers_in_round);
@@ -99,12 +120,15 @@ namespace iroha {
         /**
          * Method provide state of processing for concrete hash
          * @param hash - target tag
-         * @return value attached to parameter's hash. Default is false.
+         * @return value attached to parameter's hash. Default is false, true
+         * for evicted rounds.
          */
         bool getProcessingState(const ProposalHash &hash);
 
         /**
          * Mark hash as processed.
+         * Rounds started more than retained_rounds before the marked one are
+         * evicted from the storage
          * @param hash - target tag
          */
         void markAsProcessedState(const ProposalHash &hash);
@@ -121,18 +145,52 @@ namespace iroha {
         boost::optional<Answer> insert_votes(std::vector<VoteMessage> &votes,
                                               uint64_t peers_in_round);
 
+        /**
+         * Remove rounds started more than retained_rounds_ before given one
+         * @param hash - hash of the round which was processed
+         */
+        void evictPreceding(const ProposalHash &hash);
+
+        /**
+         * @return true if the round was evicted recently
+         */
+        bool isEvicted(const ProposalHash &hash) const;
+
         // --------| fields |--------
 
         /**
          * Active proposal storages
          */
-        std::vector<YacProposalStorage> proposal_storages_;
+        std::unordered_map<ProposalHash, YacProposalStorage>
+            proposal_storages_;
+
+        /**
+         * Hashes of active rounds in order of their appearance
+         */
+        std::deque<ProposalHash> rounds_;
+
+        /**
+         * Number of rounds kept before the last processed one
+         */
+        size_t retained_rounds_;
 
         /**
          * Processing set provide user flags about processing some hashes.
          * If hash exists <=> processed
          */
         std::unordered_set<ProposalHash> processing_state_;
+
+        /**
+         * Number of evicted rounds which are remembered
+         */
+        size_t evicted_rounds_;
+
+        /**
+         * Hashes of the latest evicted rounds in order of eviction and their
+         * set for lookup
+         */
+        std::deque<ProposalHash> evicted_order_;
+        std::unordered_set<ProposalHash> evicted_;
       };
 
     }  // namespace yac
@@ -24,16 +24,33 @@
 #include "consensus/yac/transport/yac_pb_converters.hpp"
 #include "interfaces/common_objects/peer.hpp"
 #include "logger/logger.hpp"
-#include "network/impl/grpc_channel_builder.hpp"
 
 namespace iroha {
   namespace consensus {
     namespace yac {
       // ----------| Public API |----------
 
-      NetworkImpl::NetworkImpl()
-          : network::AsyncGrpcClient<google::protobuf::Empty>(
-                logger::log("YacNetwork")) {}
+      namespace {
+        template <typename Bundle>
+        void serializeVotes(const std::vector<VoteMessage> &votes,
+                            Bundle &bundle) {
+          for (const auto &vote : votes) {
+            *bundle.add_votes() = PbConverters::serializeVote(vote);
+          }
+        }
+
+        template <typename Bundle>
+        std::vector<VoteMessage> deserializeVotes(const Bundle &bundle) {
+          std::vector<VoteMessage> votes;
+          for (const auto &pb_vote : bundle.votes()) {
+            votes.push_back(*PbConverters::deserializeVote(pb_vote));
+          }
+          return votes;
+        }
+      }  // namespace
+
+      NetworkImpl::NetworkImpl(std::shared_ptr<network::ChannelPool> channels)
+          : channels_(std::move(channels)), log_(logger::log("YacNetwork")) {}
 
       void NetworkImpl::subscribe(
           std::shared_ptr<YacNetworkNotifications> handler) {
@@ -42,38 +59,18 @@ namespace iroha {
 
       void NetworkImpl::send_vote(const shared_model::interface::Peer &to,
                                   VoteMessage vote) {
-        createPeerConnection(to);
-
-        auto request = PbConverters::serializeVote(vote);
-
-        auto call = new AsyncClientCall;
-
-        call->response_reader =
-            peers_.at(to.address())
-                ->AsyncSendVote(&call->context, request, &cq_);
-
-        call->response_reader->Finish(&call->reply, &call->status, call);
+        proto::Message message;
+        *message.mutable_vote() = PbConverters::serializeVote(vote);
+        send(to, std::move(message));
 
         log_->info("Send vote {} to {}", vote.hash.block_hash, to.address());
       }
 
       void NetworkImpl::send_commit(const shared_model::interface::Peer &to,
                                     const CommitMessage &commit) {
-        createPeerConnection(to);
-
-        proto::Commit request;
-        for (const auto &vote : commit.votes) {
-          auto pb_vote = request.add_votes();
-          *pb_vote = PbConverters::serializeVote(vote);
-        }
-
-        auto call = new AsyncClientCall;
-
-        call->response_reader =
-            peers_.at(to.address())
-                ->AsyncSendCommit(&call->context, request, &cq_);
-
-        call->response_reader->Finish(&call->reply, &call->status, call);
+        proto::Message message;
+        *message.mutable_commit() = PbConverters::serializeCommit(commit);
+        send(to, std::move(message));
 
         log_->info("Send votes bundle[size={}] commit to {}",
                    commit.votes.size(),
@@ -82,21 +79,9 @@ namespace iroha {
 
       void NetworkImpl::send_reject(const shared_model::interface::Peer &to,
                                     RejectMessage reject) {
-        createPeerConnection(to);
-
-        proto::Reject request;
-        for (const auto &vote : reject.votes) {
-          auto pb_vote = request.add_votes();
-          *pb_vote = PbConverters::serializeVote(vote);
-        }
-
-        auto call = new AsyncClientCall;
-
-        call->response_reader =
-            peers_.at(to.address())
-                ->AsyncSendReject(&call->context, request, &cq_);
-
-        call->response_reader->Finish(&call->reply, &call->status, call);
+        proto::Message message;
+        serializeVotes(reject.votes, *message.mutable_reject());
+        send(to, std::move(message));
 
         log_->info("Send votes bundle[size={}] reject to {}",
                    reject.votes.size(),
@@ -107,12 +92,9 @@ namespace iroha {
           ::grpc::ServerContext *context,
           const ::iroha::consensus::yac::proto::Vote *request,
           ::google::protobuf::Empty *response) {
-        auto vote = *PbConverters::deserializeVote(*request);
-
-        log_->info(
-            "Receive vote {} from {}", vote.hash.block_hash, context->peer());
-
-        handler_.lock()->on_vote(vote);
+        proto::Message message;
+        *message.mutable_vote() = *request;
+        handle(message, context->peer());
         return grpc::Status::OK;
       }
 
@@ -120,17 +102,9 @@ namespace iroha {
           ::grpc::ServerContext *context,
           const ::iroha::consensus::yac::proto::Commit *request,
           ::google::protobuf::Empty *response) {
-        CommitMessage commit(std::vector<VoteMessage>{});
-        for (const auto &pb_vote : request->votes()) {
-          auto vote = *PbConverters::deserializeVote(pb_vote);
-          commit.votes.push_back(vote);
-        }
-
-        log_->info("Receive commit[size={}] from {}",
-                   commit.votes.size(),
-                   context->peer());
-
-        handler_.lock()->on_commit(commit);
+        proto::Message message;
+        *message.mutable_commit() = *request;
+        handle(message, context->peer());
         return grpc::Status::OK;
       }
 
@@ -138,25 +112,69 @@ namespace iroha {
           ::grpc::ServerContext *context,
           const ::iroha::consensus::yac::proto::Reject *request,
           ::google::protobuf::Empty *response) {
-        RejectMessage reject(std::vector<VoteMessage>{});
-        for (const auto &pb_vote : request->votes()) {
-          auto vote = *PbConverters::deserializeVote(pb_vote);
-          reject.votes.push_back(vote);
-        }
-
-        log_->info("Receive reject[size={}] from {}",
-                   reject.votes.size(),
-                   context->peer());
+        proto::Message message;
+        *message.mutable_reject() = *request;
+        handle(message, context->peer());
+        return grpc::Status::OK;
+      }
 
-        handler_.lock()->on_reject(reject);
+      grpc::Status NetworkImpl::SendMessages(
+          ::grpc::ServerContext *context,
+          ::grpc::ServerReader<::iroha::consensus::yac::proto::Messages>
+              *reader,
+          ::google::protobuf::Empty *response) {
+        log_->info("Stream from {} is opened", context->peer());
+        proto::Messages frame;
+        while (reader->Read(&frame)) {
+          for (const auto &message : frame.messages()) {
+            handle(message, context->peer());
+          }
+        }
+        log_->info("Stream from {} is closed", context->peer());
         return grpc::Status::OK;
       }
 
-      void NetworkImpl::createPeerConnection(
-          const shared_model::interface::Peer &peer) {
-        if (peers_.count(peer.address()) == 0) {
-          peers_[peer.address()] =
-              network::createClient<proto::Yac>(peer.address());
+      void NetworkImpl::send(const shared_model::interface::Peer &peer,
+                             proto::Message message) {
+        std::lock_guard<std::mutex> lock(peers_mutex_);
+        auto &stream = peers_[peer.address()];
+        if (not stream) {
+          stream = std::make_unique<PeerStream>(channels_, peer.address());
+        }
+        stream->send(std::move(message));
+      }
+
+      void NetworkImpl::handle(const proto::Message &message,
+                               const std::string &from) {
+        auto handler = handler_.lock();
+        if (not handler) {
+          return;
+        }
+        switch (message.message_case()) {
+          case proto::Message::kVote: {
+            auto vote = *PbConverters::deserializeVote(message.vote());
+            log_->info("Receive vote {} from {}", vote.hash.block_hash, from);
+            handler->on_vote(vote);
+            break;
+          }
+          case proto::Message::kCommit: {
+            auto commit = PbConverters::deserializeCommit(message.commit());
+            log_->info("Receive commit[size={}] from {}",
+                       commit.votes.size(),
+                       from);
+            handler->on_commit(commit);
+            break;
+          }
+          case proto::Message::kReject: {
+            RejectMessage reject(deserializeVotes(message.reject()));
+            log_->info("Receive reject[size={}] from {}",
+                       reject.votes.size(),
+                       from);
+            handler->on_reject(reject);
+            break;
+          }
+          default:
+            log_->warn("Receive empty message from {}", from);
         }
       }
 
@@ -19,12 +19,13 @@
 #define IROHA_NETWORK_IMPL_HPP
 
 #include <memory>
+#include <mutex>
 #include <unordered_map>
 
+#include "consensus/yac/transport/impl/peer_stream.hpp"
 #include "consensus/yac/transport/yac_network_interface.hpp"  // for YacNetwork
 #include "interfaces/common_objects/types.hpp"
 #include "logger/logger.hpp"
-#include "network/impl/async_grpc_client.hpp"
 #include "yac.grpc.pb.h"
 
 namespace iroha {
@@ -36,13 +37,17 @@ namespace iroha {
       struct VoteMessage;
 
       /**
-       * Class provide implementation of transport for consensus based on grpc
+       * Class provide implementation of transport for consensus based on grpc.
+       * Messages to each peer are sent through one long-lived stream, unary
+       * calls are still served for peers which send messages one by one
        */
-      class NetworkImpl : public YacNetwork,
-                          public proto::Yac::Service,
-                          network::AsyncGrpcClient<google::protobuf::Empty> {
+      class NetworkImpl : public YacNetwork, public proto::Yac::Service {
        public:
-        NetworkImpl();
+        /**
+         * @param channels - pool of channels to other peers
+         */
+        explicit NetworkImpl(std::shared_ptr<network::ChannelPool> channels);
+
         void subscribe(
             std::shared_ptr<YacNetworkNotifications> handler) override;
         void send_commit(const shared_model::interface::Peer &to,
@@ -82,25 +87,50 @@ namespace iroha {
             const ::iroha::consensus::yac::proto::Reject *request,
             ::google::protobuf::Empty *response) override;
 
+        /**
+         * Receive stream of messages from another peer;
+         * Stream is open while the peer keeps it, every frame may carry
+         * several votes, commits and rejects
+         */
+        grpc::Status SendMessages(
+            ::grpc::ServerContext *context,
+            ::grpc::ServerReader<::iroha::consensus::yac::proto::Messages>
+                *reader,
+            ::google::protobuf::Empty *response) override;
+
        private:
         /**
-         * Create GRPC connection for given peer if it does not exist in
-         * peers map
-         * @param peer to instantiate connection with
+         * Queue message to the stream of given peer, stream is created if
+         * it does not exist in peers map
+         * @param peer - receiver of the message
+         * @param message - message to be sent
+         */
+        void send(const shared_model::interface::Peer &peer,
+                  proto::Message message);
+
+        /**
+         * Pass received message to the subscriber
+         * @param message - received message
+         * @param from - address of the sender used for logging
          */
-        void createPeerConnection(const shared_model::interface::Peer &peer);
+        void handle(const proto::Message &message, const std::string &from);
 
         /**
-         * Mapping of peer objects to connections
+         * Mapping of peer objects to streams
          */
         std::unordered_map<shared_model::interface::types::AddressType,
-                           std::unique_ptr<proto::Yac::Stub>>
+                           std::unique_ptr<PeerStream>>
             peers_;
+        std::mutex peers_mutex_;
+
+        std::shared_ptr<network::ChannelPool> channels_;
 
         /**
          * Subscriber of network messages
          */
         std::weak_ptr<YacNetworkNotifications> handler_;
+
+        logger::Logger log_;
       };
 
     }  // namespace yac
@@ -0,0 +1,120 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "consensus/yac/transport/impl/peer_stream.hpp"
+
+namespace iroha {
+  namespace consensus {
+    namespace yac {
+
+      constexpr size_t PeerStream::kMaxFrameMessages;
+      constexpr size_t PeerStream::kMaxPendingMessages;
+      constexpr std::chrono::milliseconds PeerStream::kReconnectDelay;
+
+      PeerStream::PeerStream(std::shared_ptr<network::ChannelPool> channels,
+                             std::string address)
+          : channels_(std::move(channels)),
+            address_(std::move(address)),
+            log_(logger::log("YacPeerStream")),
+            thread_(&PeerStream::run, this) {}
+
+      PeerStream::~PeerStream() {
+        {
+          std::lock_guard<std::mutex> lock(mutex_);
+          stop_ = true;
+          if (context_) {
+            context_->TryCancel();
+          }
+        }
+        cv_.notify_one();
+        thread_.join();
+      }
+
+      void PeerStream::send(proto::Message message) {
+        {
+          std::lock_guard<std::mutex> lock(mutex_);
+          if (pending_.size() == kMaxPendingMessages) {
+            log_->warn("Queue to {} is full, oldest message dropped",
+                       address_);
+            pending_.pop_front();
+          }
+          pending_.push_back(std::move(message));
+        }
+        cv_.notify_one();
+      }
+
+      void PeerStream::run() {
+        proto::Messages frame;
+        while (true) {
+          {
+            std::unique_lock<std::mutex> lock(mutex_);
+            cv_.wait(lock, [this] { return stop_ or not pending_.empty(); });
+            if (stop_) {
+              break;
+            }
+            while (not pending_.empty()
+                   and static_cast<size_t>(frame.messages_size())
+                       < kMaxFrameMessages) {
+              *frame.add_messages() = std::move(pending_.front());
+              pending_.pop_front();
+            }
+          }
+
+          // broken stream is detected only on write, so frame is retried
+          // once on a new stream before it is dropped
+          if (not write(frame) and not write(frame)) {
+            log_->warn("Dropped {} messages to {}",
+                       frame.messages_size(),
+                       address_);
+            std::unique_lock<std::mutex> lock(mutex_);
+            cv_.wait_for(lock, kReconnectDelay, [this] { return stop_; });
+          }
+          frame.Clear();
+        }
+        close();
+      }
+
+      bool PeerStream::write(const proto::Messages &frame) {
+        if (not writer_) {
+          {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (stop_) {
+              return false;
+            }
+            context_ = std::make_unique<grpc::ClientContext>();
+          }
+          // channel is requested on every reopen, so that the stream moves
+          // to a new connection when the pool replaces unhealthy channel.
+          // Call may wait for connection, so it is started without the lock
+          stub_ = channels_->client<proto::Yac>(address_);
+          writer_ = stub_->SendMessages(context_.get(), &response_);
+        }
+        if (writer_->Write(frame)) {
+          return true;
+        }
+        close();
+        return false;
+      }
+
+      void PeerStream::close() {
+        if (not writer_) {
+          return;
+        }
+        writer_->WritesDone();
+        auto status = writer_->Finish();
+        channels_->report(address_, status);
+        if (not status.ok()) {
+          log_->warn("Stream to {} is closed: {}",
+                     address_,
+                     status.error_message());
+        }
+        writer_.reset();
+        std::lock_guard<std::mutex> lock(mutex_);
+        context_.reset();
+      }
+
+    }  // namespace yac
+  }    // namespace consensus
+}  // namespace iroha
@@ -0,0 +1,101 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_YAC_PEER_STREAM_HPP
+#define IROHA_YAC_PEER_STREAM_HPP
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include "logger/logger.hpp"
+#include "network/impl/channel_pool.hpp"
+#include "yac.grpc.pb.h"
+
+namespace iroha {
+  namespace consensus {
+    namespace yac {
+
+      /**
+       * Long-lived stream of consensus messages to one peer.
+       * Messages are sent from a dedicated thread, messages accumulated while
+       * previous frame was written are coalesced into the next frame.
+       * Stream is reopened on the channel from the pool when it breaks
+       */
+      class PeerStream {
+       public:
+        /// maximum number of messages in one frame
+        static constexpr size_t kMaxFrameMessages = 64;
+
+        /// maximum number of queued messages, older ones are dropped first
+        static constexpr size_t kMaxPendingMessages = 1024;
+
+        /// delay before next attempt to open the stream after a failure
+        static constexpr std::chrono::milliseconds kReconnectDelay{500};
+
+        /**
+         * @param channels - pool of channels to other peers
+         * @param address - address of the peer
+         */
+        PeerStream(std::shared_ptr<network::ChannelPool> channels,
+                   std::string address);
+
+        ~PeerStream();
+
+        PeerStream(const PeerStream &) = delete;
+        PeerStream &operator=(const PeerStream &) = delete;
+
+        /**
+         * Queue message for sending, call does not block on network
+         * @param message - message to be sent
+         */
+        void send(proto::Message message);
+
+       private:
+        /**
+         * Sending loop of the stream thread
+         */
+        void run();
+
+        /**
+         * Write frame to the stream, open the stream if required
+         * @param frame - messages to be written
+         * @return true if frame was written
+         */
+        bool write(const proto::Messages &frame);
+
+        /**
+         * Finish current stream if it is opened
+         */
+        void close();
+
+        std::shared_ptr<network::ChannelPool> channels_;
+        std::string address_;
+
+        std::mutex mutex_;
+        std::condition_variable cv_;
+        std::deque<proto::Message> pending_;
+        bool stop_ = false;
+
+        // context is guarded by mutex_ in order to cancel the stream on stop,
+        // stub and writer are used only by the stream thread
+        std::unique_ptr<grpc::ClientContext> context_;
+        std::unique_ptr<proto::Yac::StubInterface> stub_;
+        google::protobuf::Empty response_;
+        std::unique_ptr<grpc::ClientWriterInterface<proto::Messages>> writer_;
+
+        logger::Logger log_;
+        std::thread thread_;
+      };
+
+    }  // namespace yac
+  }    // namespace consensus
+}  // namespace iroha
+
+#endif  // IROHA_YAC_PEER_STREAM_HPP
@@ -18,6 +18,8 @@
 #ifndef IROHA_YAC_PB_CONVERTERS_HPP
 #define IROHA_YAC_PB_CONVERTERS_HPP
 
+#include <unordered_set>
+
 #include "builders/default_builders.hpp"
 #include "common/byteutils.hpp"
 #include "consensus/yac/messages.hpp"
@@ -119,6 +121,114 @@ namespace iroha {
 
           return vote;
         }
+
+        /**
+         * Pack votes of commit into certificate. Votes are expected to share
+         * the same hash, votes with other hash and repeated votes of the same
+         * peer are skipped
+         * @param commit - commit to be packed
+         * @return certificate with hash and public keys stored once
+         */
+        static proto::Commit serializeCommit(const CommitMessage &commit) {
+          proto::Commit pb_commit;
+          if (commit.votes.empty()) {
+            return pb_commit;
+          }
+          const auto &hash = commit.votes.front().hash;
+          pb_commit.set_proposal(hash.proposal_hash);
+          pb_commit.set_block(hash.block_hash);
+
+          std::unordered_set<std::string> keys;
+          for (const auto &vote : commit.votes) {
+            auto pubkey = shared_model::crypto::toBinaryString(
+                vote.signature->publicKey());
+            if (vote.hash != hash or not keys.insert(pubkey).second) {
+              continue;
+            }
+            auto endorsement = pb_commit.add_endorsements();
+            endorsement->set_signature(shared_model::crypto::toBinaryString(
+                vote.signature->signedData()));
+            endorsement->set_block_signature(
+                shared_model::crypto::toBinaryString(
+                    vote.hash.block_signature->signedData()));
+            auto block_pubkey = shared_model::crypto::toBinaryString(
+                vote.hash.block_signature->publicKey());
+            if (block_pubkey != pubkey) {
+              endorsement->set_block_pubkey(std::move(block_pubkey));
+            }
+            endorsement->set_pubkey(std::move(pubkey));
+          }
+          return pb_commit;
+        }
+
+        /**
+         * Unpack certificate into votes. Repeated endorsements of the same
+         * peer are skipped, so they are not verified, as well as endorsements
+         * with malformed keys or signatures. Commit without endorsements is
+         * read from its votes
+         * @param pb_commit - certificate to be unpacked
+         * @return commit with a vote per endorsement
+         */
+        static CommitMessage deserializeCommit(const proto::Commit &pb_commit) {
+          std::vector<VoteMessage> votes;
+          std::unordered_set<std::string> keys;
+          if (pb_commit.endorsements().empty()) {
+            for (const auto &pb_vote : pb_commit.votes()) {
+              auto vote = deserializeVote(pb_vote);
+              if (vote and isSigned(*vote)
+                  and keys.insert(pb_vote.signature().pubkey()).second) {
+                votes.push_back(std::move(*vote));
+              }
+            }
+            return CommitMessage(std::move(votes));
+          }
+
+          votes.reserve(pb_commit.endorsements_size());
+          for (const auto &endorsement : pb_commit.endorsements()) {
+            VoteMessage vote;
+            vote.hash.proposal_hash = pb_commit.proposal();
+            vote.hash.block_hash = pb_commit.block();
+            vote.hash.block_signature =
+                deserializeSignature(endorsement.block_pubkey().empty()
+                                         ? endorsement.pubkey()
+                                         : endorsement.block_pubkey(),
+                                     endorsement.block_signature());
+            vote.signature = deserializeSignature(endorsement.pubkey(),
+                                                  endorsement.signature());
+            if (isSigned(vote) and keys.insert(endorsement.pubkey()).second) {
+              votes.push_back(std::move(vote));
+            }
+          }
+          return CommitMessage(std::move(votes));
+        }
+
+       private:
+        /**
+         * @return true if both signatures of the vote were built
+         */
+        static bool isSigned(const VoteMessage &vote) {
+          return vote.signature and vote.hash.block_signature;
+        }
+
+        static std::shared_ptr<shared_model::interface::Signature>
+        deserializeSignature(const std::string &pubkey,
+                             const std::string &signature) {
+          std::shared_ptr<shared_model::interface::Signature> result;
+          shared_model::builder::DefaultSignatureBuilder()
+              .publicKey(shared_model::crypto::PublicKey(pubkey))
+              .signedData(shared_model::crypto::Signed(signature))
+              .build()
+              .match(
+                  [&result](iroha::expected::Value<
+                            std::shared_ptr<shared_model::interface::Signature>>
+                                &sig) { result = sig.value; },
+                  [](iroha::expected::Error<std::shared_ptr<std::string>>
+                         &reason) {
+                    logger::log("YacPbConverter::deserializeCommit")
+                        ->error("Cannot build signature: {}", *reason.error);
+                  });
+          return result;
+        }
       };
     }  // namespace yac
   }    // namespace consensus
@@ -4,9 +4,11 @@
  */
 
 #include "main/application.hpp"
+#include "ametsuchi/impl/peer_query_cache.hpp"
 #include "ametsuchi/impl/postgres_ordering_service_persistent_state.hpp"
 #include "ametsuchi/impl/wsv_restorer_impl.hpp"
 #include "backend/protobuf/common_objects/proto_common_objects_factory.hpp"
+#include "builders/protobuf/common_objects/proto_peer_builder.hpp"
 #include "consensus/yac/impl/supermajority_checker_impl.hpp"
 #include "execution/query_execution_impl.hpp"
 #include "multi_sig_transactions/gossip_propagation_strategy.hpp"
@@ -15,6 +17,7 @@
 #include "multi_sig_transactions/mst_time_provider_impl.hpp"
 #include "multi_sig_transactions/storage/mst_storage_impl.hpp"
 #include "multi_sig_transactions/transport/mst_transport_grpc.hpp"
+#include "synchronizer/impl/fast_sync.hpp"
 #include "torii/impl/status_bus_impl.hpp"
 #include "validators/field_validator.hpp"
 
@@ -41,7 +44,11 @@ Irohad::Irohad(const std::string &block_store_dir,
                std::chrono::milliseconds vote_delay,
                std::chrono::milliseconds load_delay,
                const shared_model::crypto::Keypair &keypair,
-               bool is_mst_supported)
+               bool is_mst_supported,
+               bool fast_sync,
+               size_t proposal_fanout,
+               iroha::ordering::QueueLimits ordering_queue_limits,
+               boost::optional<iroha::ordering::ProposalBounds> proposal_bounds)
     : block_store_dir_(block_store_dir),
       pg_conn_(pg_conn),
       torii_port_(torii_port),
@@ -51,6 +58,10 @@ Irohad::Irohad(const std::string &block_store_dir,
       vote_delay_(vote_delay),
       load_delay_(load_delay),
       is_mst_supported_(is_mst_supported),
+      fast_sync_(fast_sync),
+      proposal_fanout_(proposal_fanout),
+      ordering_queue_limits_(ordering_queue_limits),
+      proposal_bounds_(proposal_bounds),
       keypair(keypair) {
   log_ = logger::log("IROHAD");
   log_->info("created");
@@ -66,6 +77,9 @@ void Irohad::init() {
   // Recover VSW from the existing ledger to be sure it is consistent
   initWsvRestorer();
   restoreWsv();
+  if (fast_sync_) {
+    syncFromCheckpoint();
+  }
 
   initCryptoProvider();
   initValidators();
@@ -131,8 +145,13 @@ bool Irohad::restoreWsv() {
 /**
  * Initializing peer query interface
  */
-std::unique_ptr<iroha::ametsuchi::PeerQuery> Irohad::initPeerQuery() {
-  return std::make_unique<ametsuchi::PeerQueryWsv>(storage->getWsvQuery());
+std::shared_ptr<iroha::ametsuchi::PeerQuery> Irohad::initPeerQuery() {
+  if (not peer_query_) {
+    peer_query_ = std::make_shared<ametsuchi::PeerQueryCache>(
+        std::make_shared<ametsuchi::PeerQueryWsv>(storage->getWsvQuery()),
+        storage->on_commit());
+  }
+  return peer_query_;
 }
 
 /**
@@ -167,7 +186,13 @@ void Irohad::initOrderingGate() {
                                                  max_proposal_size_,
                                                  proposal_delay_,
                                                  ordering_service_storage_,
-                                                 storage->getBlockQuery());
+                                                 storage->getBlockQuery(),
+                                                 storage->on_commit(),
+                                                 timer_wheel_,
+                                                 channel_pool_,
+                                                 proposal_fanout_,
+                                                 ordering_queue_limits_,
+                                                 proposal_bounds_);
   log_->info("[Init] => init ordering gate - [{}]",
              logger::logBool(ordering_gate));
 }
@@ -189,8 +214,11 @@ void Irohad::initSimulator() {
  * Initializing block loader
  */
 void Irohad::initBlockLoader() {
-  block_loader =
-      loader_init.initBlockLoader(initPeerQuery(), storage->getBlockQuery());
+  checkpoint_keeper_ = std::make_shared<CheckpointKeeper>(storage, keypair);
+  block_loader = loader_init.initBlockLoader(initPeerQuery(),
+                                             storage->getBlockQuery(),
+                                             channel_pool_,
+                                             checkpoint_keeper_);
 
   log_->info("[Init] => block loader");
 }
@@ -204,7 +232,9 @@ void Irohad::initConsensusGate() {
                                               block_loader,
                                               keypair,
                                               vote_delay_,
-                                              load_delay_);
+                                              load_delay_,
+                                              timer_wheel_,
+                                              channel_pool_);
 
   log_->info("[Init] => consensus gate");
 }
@@ -245,15 +275,33 @@ void Irohad::initStatusBus() {
 
 void Irohad::initMstProcessor() {
   if (is_mst_supported_) {
-    auto mst_transport = std::make_shared<MstTransportGrpc>();
+    // other peers know this peer by its ledger address
+    std::shared_ptr<shared_model::interface::Peer> my_peer =
+        std::make_shared<shared_model::proto::Peer>(
+            shared_model::proto::PeerBuilder()
+                .address("0.0.0.0:" + std::to_string(internal_port_))
+                .pubkey(keypair.publicKey())
+                .build());
+    if (auto peers = initPeerQuery()->getLedgerPeers()) {
+      auto it = std::find_if(
+          peers->begin(), peers->end(), [this](const auto &peer) {
+            return peer->pubkey() == keypair.publicKey();
+          });
+      if (it != peers->end()) {
+        my_peer = *it;
+      }
+    }
+    auto mst_transport =
+        std::make_shared<MstTransportGrpc>(channel_pool_, my_peer);
     auto mst_completer = std::make_shared<DefaultCompleter>();
     auto mst_storage = std::make_shared<MstStorageStateImpl>(mst_completer);
     // TODO: IR-1317 @l4l (02/05/18) magics should be replaced with options via
     // cli parameters
     auto mst_propagation = std::make_shared<GossipPropagationStrategy>(
-        std::make_shared<ametsuchi::PeerQueryWsv>(storage->getWsvQuery()),
+        initPeerQuery(),
         std::chrono::seconds(5) /*emitting period*/,
-        2 /*amount per once*/);
+        2 /*amount per once*/,
+        timer_wheel_);
     auto mst_time = std::make_shared<MstTimeProviderImpl>();
     mst_processor = std::make_shared<FairMstProcessor>(
         mst_transport, mst_storage, mst_propagation, mst_time);
@@ -296,6 +344,27 @@ void Irohad::initWsvRestorer() {
   wsv_restorer_ = std::make_shared<iroha::ametsuchi::WsvRestorerImpl>();
 }
 
+/**
+ * Bootstrapping ledger from checkpoint of other peers, peers are taken from
+ * the local ledger, so shared peer query is not created before the snapshot
+ * is loaded
+ */
+void Irohad::syncFromCheckpoint() {
+  auto peer_query = std::make_shared<PeerQueryWsv>(storage->getWsvQuery());
+  auto loader = std::make_shared<BlockLoaderImpl>(
+      peer_query, storage->getBlockQuery(), channel_pool_);
+  FastSync fast_sync(
+      loader,
+      storage,
+      peer_query,
+      std::make_shared<consensus::yac::SupermajorityCheckerImpl>());
+  if (not fast_sync.run()) {
+    log_->warn("Ledger is not synchronized from checkpoint");
+  }
+
+  log_->info("[Init] => fast sync");
+}
+
 /**
  * Run iroha daemon
  */
@@ -31,6 +31,7 @@
 #include "multi_sig_transactions/mst_processor.hpp"
 #include "network/block_loader.hpp"
 #include "network/consensus_gate.hpp"
+#include "network/impl/channel_pool.hpp"
 #include "network/impl/peer_communication_service_impl.hpp"
 #include "network/ordering_gate.hpp"
 #include "network/peer_communication_service.hpp"
@@ -38,6 +39,7 @@
 #include "simulator/impl/simulator.hpp"
 #include "synchronizer/impl/synchronizer_impl.hpp"
 #include "synchronizer/synchronizer.hpp"
+#include "timer/timer_wheel.hpp"
 #include "torii/command_service.hpp"
 #include "torii/processor/query_processor_impl.hpp"
 #include "torii/processor/transaction_processor_impl.hpp"
@@ -70,6 +72,13 @@ class Irohad {
    * peer
    * @param keypair - public and private keys for crypto signer
    * @param is_mst_supported - enable or disable mst processing support
+   * @param fast_sync - bootstrap ledger from a checkpoint of other peers
+   * @param proposal_fanout - fanout of the tree along which proposals are
+   * relayed, 0 to send proposals to every peer directly
+   * @param ordering_queue_limits - capacity and admission policy of the queue
+   * of ordering service
+   * @param proposal_bounds - bounds of adaptive proposal size and delay, fixed
+   * max_proposal_size and proposal_delay are used if none
    */
   Irohad(const std::string &block_store_dir,
          const std::string &pg_conn,
@@ -80,7 +89,13 @@ class Irohad {
          std::chrono::milliseconds vote_delay,
          std::chrono::milliseconds load_delay,
          const shared_model::crypto::Keypair &keypair,
-         bool is_mst_supported);
+         bool is_mst_supported,
+         bool fast_sync = false,
+         size_t proposal_fanout = 0,
+         iroha::ordering::QueueLimits ordering_queue_limits =
+             iroha::ordering::QueueLimits(),
+         boost::optional<iroha::ordering::ProposalBounds> proposal_bounds =
+             boost::none);
 
   /**
    * Initialization of whole objects in system
@@ -115,7 +130,10 @@ class Irohad {
 
   virtual void initStorage();
 
-  virtual std::unique_ptr<iroha::ametsuchi::PeerQuery> initPeerQuery();
+  /**
+   * @return peer query shared by all components, created on first call
+   */
+  virtual std::shared_ptr<iroha::ametsuchi::PeerQuery> initPeerQuery();
 
   virtual void initCryptoProvider();
 
@@ -146,6 +164,11 @@ class Irohad {
    */
   virtual void initWsvRestorer();
 
+  /**
+   * Load checkpoint of other peers instead of applying all blocks
+   */
+  virtual void syncFromCheckpoint();
+
   // constructor dependencies
   std::string block_store_dir_;
   std::string pg_conn_;
@@ -156,9 +179,24 @@ class Irohad {
   std::chrono::milliseconds vote_delay_;
   std::chrono::milliseconds load_delay_;
   bool is_mst_supported_;
+  bool fast_sync_;
+  size_t proposal_fanout_;
+  iroha::ordering::QueueLimits ordering_queue_limits_;
+  boost::optional<iroha::ordering::ProposalBounds> proposal_bounds_;
 
   // ------------------------| internal dependencies |-------------------------
 
+  // timers of consensus, ordering and mst, declared first to outlive them
+  std::shared_ptr<iroha::timer::TimerWheel> timer_wheel_ =
+      std::make_shared<iroha::timer::TimerWheel>();
+
+  // channels to other peers shared by all outbound transports
+  std::shared_ptr<iroha::network::ChannelPool> channel_pool_ =
+      std::make_shared<iroha::network::ChannelPool>();
+
+  // peers of the ledger
+  std::shared_ptr<iroha::ametsuchi::PeerQuery> peer_query_;
+
   // crypto provider
   std::shared_ptr<shared_model::crypto::CryptoModelSigner<>> crypto_signer_;
 
@@ -175,6 +213,9 @@ class Irohad {
   // simulator
   std::shared_ptr<iroha::simulator::Simulator> simulator;
 
+  // checkpoints for joining peers
+  std::shared_ptr<iroha::network::CheckpointKeeper> checkpoint_keeper_;
+
   // block loader
   std::shared_ptr<iroha::network::BlockLoader> block_loader;
 
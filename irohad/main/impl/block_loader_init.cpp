@@ -22,19 +22,25 @@ using namespace iroha;
 using namespace iroha::ametsuchi;
 using namespace iroha::network;
 
-auto BlockLoaderInit::createService(std::shared_ptr<BlockQuery> storage) {
-  return std::make_shared<BlockLoaderService>(storage);
+auto BlockLoaderInit::createService(
+    std::shared_ptr<BlockQuery> storage,
+    std::shared_ptr<CheckpointKeeper> checkpoints) {
+  return std::make_shared<BlockLoaderService>(storage, checkpoints);
 }
 
 auto BlockLoaderInit::createLoader(std::shared_ptr<PeerQuery> peer_query,
-                                   std::shared_ptr<BlockQuery> storage) {
-  return std::make_shared<BlockLoaderImpl>(peer_query, storage);
+                                   std::shared_ptr<BlockQuery> storage,
+                                   std::shared_ptr<ChannelPool> channels) {
+  return std::make_shared<BlockLoaderImpl>(
+      peer_query, storage, std::move(channels));
 }
 
 std::shared_ptr<BlockLoader> BlockLoaderInit::initBlockLoader(
     std::shared_ptr<PeerQuery> peer_query,
-    std::shared_ptr<BlockQuery> storage) {
-  service = createService(storage);
-  loader = createLoader(peer_query, storage);
+    std::shared_ptr<BlockQuery> storage,
+    std::shared_ptr<ChannelPool> channels,
+    std::shared_ptr<CheckpointKeeper> checkpoints) {
+  service = createService(storage, checkpoints);
+  loader = createLoader(peer_query, storage, std::move(channels));
   return loader;
 }
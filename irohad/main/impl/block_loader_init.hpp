@@ -32,17 +32,20 @@ namespace iroha {
       /**
        * Create block loader service with given storage
        * @param storage - used to retrieve blocks
+       * @param checkpoints - used to retrieve snapshots
        * @return initialized service
        */
-      auto createService(std::shared_ptr<ametsuchi::BlockQuery> storage);
+      auto createService(std::shared_ptr<ametsuchi::BlockQuery> storage,
+                         std::shared_ptr<CheckpointKeeper> checkpoints);
 
       /**
        * Create block loader for loading blocks from given peer by top block
+       * @param channels - pool of channels to other peers
        * @return initialized loader
        */
-      auto createLoader(
-          std::shared_ptr<ametsuchi::PeerQuery> peer_query,
-          std::shared_ptr<ametsuchi::BlockQuery> storage);
+      auto createLoader(std::shared_ptr<ametsuchi::PeerQuery> peer_query,
+                        std::shared_ptr<ametsuchi::BlockQuery> storage,
+                        std::shared_ptr<ChannelPool> channels);
 
      public:
       /**
@@ -51,7 +54,9 @@ namespace iroha {
        */
       std::shared_ptr<BlockLoader> initBlockLoader(
           std::shared_ptr<ametsuchi::PeerQuery> peer_query,
-          std::shared_ptr<ametsuchi::BlockQuery> storage);
+          std::shared_ptr<ametsuchi::BlockQuery> storage,
+          std::shared_ptr<ChannelPool> channels,
+          std::shared_ptr<CheckpointKeeper> checkpoints = nullptr);
 
       std::shared_ptr<BlockLoaderImpl> loader;
       std::shared_ptr<BlockLoaderService> service;
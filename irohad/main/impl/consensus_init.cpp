@@ -23,6 +23,7 @@
 #include "consensus/yac/impl/yac_hash_provider_impl.hpp"
 #include "consensus/yac/storage/yac_proposal_storage.hpp"
 #include "consensus/yac/transport/impl/network_impl.hpp"
+#include "timer/rx_timer.hpp"
 
 namespace iroha {
   namespace consensus {
@@ -33,8 +34,9 @@ namespace iroha {
         return std::make_shared<PeerOrdererImpl>(wsv);
       }
 
-      auto YacInit::createNetwork() {
-        consensus_network = std::make_shared<NetworkImpl>();
+      auto YacInit::createNetwork(
+          std::shared_ptr<network::ChannelPool> channels) {
+        consensus_network = std::make_shared<NetworkImpl>(std::move(channels));
         return consensus_network;
       }
 
@@ -45,34 +47,13 @@ namespace iroha {
         return crypto;
       }
 
-      auto YacInit::createTimer(std::chrono::milliseconds delay_milliseconds) {
-        return std::make_shared<TimerImpl>([delay_milliseconds] {
-          // static factory with a single thread
-          //
-          // observe_on_new_thread -- coordination which creates new thread with
-          // observe_on strategy -- all subsequent operations will be performed
-          // on this thread.
-          //
-          // scheduler owns a timeline that is exposed by the now() method.
-          // scheduler is also a factory for workers in that timeline.
-          //
-          // coordination is a factory for coordinators and has a scheduler.
-          //
-          // coordinator has a worker, and is a factory for coordinated
-          // observables, subscribers and schedulable functions.
-          //
-          // A new thread scheduler is created
-          // by calling .create_coordinator().get_scheduler()
-          //
-          // static allows to reuse the same thread in subsequent calls to this
-          // lambda
-          static rxcpp::observe_on_one_worker coordination(
-              rxcpp::observe_on_new_thread()
-                  .create_coordinator()
-                  .get_scheduler());
-          return rxcpp::observable<>::timer(
-              std::chrono::milliseconds(delay_milliseconds), coordination);
-        });
+      auto YacInit::createTimer(
+          std::chrono::milliseconds delay_milliseconds,
+          std::shared_ptr<timer::TimerWheel> timer_wheel) {
+        return std::make_shared<TimerImpl>(
+            [delay_milliseconds, timer_wheel = std::move(timer_wheel)] {
+              return timer::makeTimer(timer_wheel, delay_milliseconds);
+            });
       }
 
       auto YacInit::createHashProvider() {
@@ -82,11 +63,14 @@ namespace iroha {
       std::shared_ptr<consensus::yac::Yac> YacInit::createYac(
           ClusterOrdering initial_order,
           const shared_model::crypto::Keypair &keypair,
-          std::chrono::milliseconds delay_milliseconds) {
+          std::chrono::milliseconds delay_milliseconds,
+          std::shared_ptr<timer::TimerWheel> timer_wheel,
+          std::shared_ptr<network::ChannelPool> channels) {
         return Yac::create(YacVoteStorage(),
-                           createNetwork(),
+                           createNetwork(std::move(channels)),
                            createCryptoProvider(keypair),
-                           createTimer(delay_milliseconds),
+                           createTimer(delay_milliseconds,
+                                       std::move(timer_wheel)),
                            initial_order);
       }
 
@@ -96,12 +80,16 @@ namespace iroha {
           std::shared_ptr<network::BlockLoader> block_loader,
           const shared_model::crypto::Keypair &keypair,
           std::chrono::milliseconds vote_delay_milliseconds,
-          std::chrono::milliseconds load_delay_milliseconds) {
+          std::chrono::milliseconds load_delay_milliseconds,
+          std::shared_ptr<timer::TimerWheel> timer_wheel,
+          std::shared_ptr<network::ChannelPool> channels) {
         auto peer_orderer = createPeerOrderer(wsv);
 
         auto yac = createYac(peer_orderer->getInitialOrdering().value(),
                              keypair,
-                             vote_delay_milliseconds);
+                             vote_delay_milliseconds,
+                             std::move(timer_wheel),
+                             std::move(channels));
         consensus_network->subscribe(yac);
 
         auto hash_provider = createHashProvider();
@@ -33,6 +33,7 @@
 #include "cryptography/keypair.hpp"
 #include "network/block_loader.hpp"
 #include "simulator/block_creator.hpp"
+#include "timer/timer_wheel.hpp"
 
 namespace iroha {
   namespace consensus {
@@ -44,18 +45,21 @@ namespace iroha {
 
         auto createPeerOrderer(std::shared_ptr<ametsuchi::PeerQuery> wsv);
 
-        auto createNetwork();
+        auto createNetwork(std::shared_ptr<network::ChannelPool> channels);
 
         auto createCryptoProvider(const shared_model::crypto::Keypair &keypair);
 
-        auto createTimer(std::chrono::milliseconds delay_milliseconds);
+        auto createTimer(std::chrono::milliseconds delay_milliseconds,
+                         std::shared_ptr<timer::TimerWheel> timer_wheel);
 
         auto createHashProvider();
 
         std::shared_ptr<consensus::yac::Yac> createYac(
             ClusterOrdering initial_order,
             const shared_model::crypto::Keypair &keypair,
-            std::chrono::milliseconds delay_milliseconds);
+            std::chrono::milliseconds delay_milliseconds,
+            std::shared_ptr<timer::TimerWheel> timer_wheel,
+            std::shared_ptr<network::ChannelPool> channels);
 
        public:
         std::shared_ptr<YacGate> initConsensusGate(
@@ -64,7 +68,9 @@ namespace iroha {
             std::shared_ptr<network::BlockLoader> block_loader,
             const shared_model::crypto::Keypair &keypair,
             std::chrono::milliseconds vote_delay_milliseconds,
-            std::chrono::milliseconds load_delay_milliseconds);
+            std::chrono::milliseconds load_delay_milliseconds,
+            std::shared_ptr<timer::TimerWheel> timer_wheel,
+            std::shared_ptr<network::ChannelPool> channels);
 
         std::shared_ptr<NetworkImpl> consensus_network;
       };
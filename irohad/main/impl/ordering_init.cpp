@@ -8,6 +8,7 @@
 #include "interfaces/common_objects/peer.hpp"
 #include "interfaces/common_objects/types.hpp"
 #include "interfaces/iroha_internal/block.hpp"
+#include "timer/rx_timer.hpp"
 
 namespace iroha {
   namespace network {
@@ -39,17 +40,36 @@ namespace iroha {
         std::chrono::milliseconds delay_milliseconds,
         std::shared_ptr<network::OrderingServiceTransport> transport,
         std::shared_ptr<ametsuchi::OrderingServicePersistentState>
-            persistent_state) {
+            persistent_state,
+        std::shared_ptr<timer::TimerWheel> timer_wheel,
+        ordering::QueueLimits queue_limits,
+        boost::optional<ordering::ProposalBounds> proposal_bounds,
+        rxcpp::observable<shared_model::interface::types::HeightType>
+            ledger_heights) {
       auto factory = std::make_unique<shared_model::proto::ProtoProposalFactory<
           shared_model::validation::DefaultProposalValidator>>();
+      std::shared_ptr<ordering::ProposalController> controller;
+      if (proposal_bounds) {
+        log_->info("Adaptive proposal sizing with latency target {} ms",
+                   proposal_bounds->latency_target.count());
+        controller =
+            std::make_shared<ordering::ProposalController>(*proposal_bounds);
+        // the controller decides on every timeout whether its delay elapsed
+        delay_milliseconds = proposal_bounds->min_delay;
+      }
       return std::make_shared<ordering::OrderingServiceImpl>(
           wsv,
           max_size,
-          rxcpp::observable<>::interval(delay_milliseconds,
-                                        rxcpp::observe_on_new_thread()),
+          timer::makeInterval(std::move(timer_wheel), delay_milliseconds),
           transport,
           persistent_state,
-          std::move(factory));
+          std::move(factory),
+          true,
+          queue_limits,
+          ordering::OrderingServiceImpl::kDefaultDuplicateWindow,
+          ordering::ProposalHeightAllocator::kDefaultRange,
+          std::move(controller),
+          std::move(ledger_heights));
     }
 
     std::shared_ptr<OrderingGate> OrderingInit::initOrderingGate(
@@ -58,7 +78,14 @@ namespace iroha {
         std::chrono::milliseconds delay_milliseconds,
         std::shared_ptr<ametsuchi::OrderingServicePersistentState>
             persistent_state,
-        std::shared_ptr<ametsuchi::BlockQuery> block_query) {
+        std::shared_ptr<ametsuchi::BlockQuery> block_query,
+        rxcpp::observable<std::shared_ptr<shared_model::interface::Block>>
+            committed_blocks,
+        std::shared_ptr<timer::TimerWheel> timer_wheel,
+        std::shared_ptr<ChannelPool> channels,
+        size_t proposal_fanout,
+        ordering::QueueLimits queue_limits,
+        boost::optional<ordering::ProposalBounds> proposal_bounds) {
       auto ledger_peers = wsv->getLedgerPeers();
       if (not ledger_peers or ledger_peers.value().empty()) {
         log_->error(
@@ -68,15 +95,27 @@ namespace iroha {
       log_->info("Ordering gate is at {}", network_address);
       ordering_gate_transport =
           std::make_shared<iroha::ordering::OrderingGateTransportGrpc>(
-              network_address);
+              network_address, channels, wsv);
 
       ordering_service_transport =
-          std::make_shared<ordering::OrderingServiceTransportGrpc>();
+          std::make_shared<ordering::OrderingServiceTransportGrpc>(
+              std::move(channels), proposal_fanout);
+      // proposals continue from the top block after restart and follow
+      // the commits
+      auto ledger_heights =
+          committed_blocks
+              .map([](const auto &block) { return block->height(); })
+              .start_with(shared_model::interface::types::HeightType{
+                  block_query->getTopBlockHeight()});
       ordering_service = createService(wsv,
                                        max_size,
                                        delay_milliseconds,
                                        ordering_service_transport,
-                                       persistent_state);
+                                       persistent_state,
+                                       std::move(timer_wheel),
+                                       queue_limits,
+                                       proposal_bounds,
+                                       std::move(ledger_heights));
       ordering_service_transport->subscribe(ordering_service);
       ordering_gate = createGate(ordering_gate_transport, block_query);
       return ordering_gate;
@@ -25,6 +25,7 @@
 #include "ordering/impl/ordering_gate_transport_grpc.hpp"
 #include "ordering/impl/ordering_service_impl.hpp"
 #include "ordering/impl/ordering_service_transport_grpc.hpp"
+#include "timer/timer_wheel.hpp"
 
 namespace iroha {
 
@@ -55,6 +56,12 @@ namespace iroha {
        * @param max_size - limitation of proposal size
        * @param delay_milliseconds - delay before emitting proposal
        * @param loop - handler of async events
+       * @param timer_wheel - wheel which emits proposal timeouts
+       * @param queue_limits - capacity and admission policy of the queue
+       * @param proposal_bounds - bounds of adaptive proposal size and delay,
+       * timeouts are emitted with the minimum delay
+       * @param ledger_heights - heights of the ledger which proposal heights
+       * are aligned to
        */
       auto createService(
           std::shared_ptr<ametsuchi::PeerQuery> wsv,
@@ -62,7 +69,12 @@ namespace iroha {
           std::chrono::milliseconds delay_milliseconds,
           std::shared_ptr<network::OrderingServiceTransport> transport,
           std::shared_ptr<ametsuchi::OrderingServicePersistentState>
-              persistent_state);
+              persistent_state,
+          std::shared_ptr<timer::TimerWheel> timer_wheel,
+          ordering::QueueLimits queue_limits,
+          boost::optional<ordering::ProposalBounds> proposal_bounds,
+          rxcpp::observable<shared_model::interface::types::HeightType>
+              ledger_heights);
 
      public:
       /**
@@ -72,6 +84,15 @@ namespace iroha {
        * @param max_size - limitation of proposal size
        * @param delay_milliseconds - delay before emitting proposal
        * @param block_query - block store to get last block height
+       * @param committed_blocks - blocks committed to the storage
+       * @param timer_wheel - wheel which emits proposal timeouts
+       * @param channels - pool of channels to other peers
+       * @param proposal_fanout - fanout of the tree along which proposals are
+       * relayed, 0 to send proposals to every peer directly
+       * @param queue_limits - capacity and admission policy of the queue of
+       * ordering service
+       * @param proposal_bounds - bounds of adaptive proposal size and delay,
+       * fixed max_size and delay_milliseconds are used if none
        * @return efficient implementation of OrderingGate
        */
       std::shared_ptr<iroha::network::OrderingGate> initOrderingGate(
@@ -80,7 +101,15 @@ namespace iroha {
           std::chrono::milliseconds delay_milliseconds,
           std::shared_ptr<ametsuchi::OrderingServicePersistentState>
               persistent_state,
-          std::shared_ptr<ametsuchi::BlockQuery> block_query);
+          std::shared_ptr<ametsuchi::BlockQuery> block_query,
+          rxcpp::observable<std::shared_ptr<shared_model::interface::Block>>
+              committed_blocks,
+          std::shared_ptr<timer::TimerWheel> timer_wheel,
+          std::shared_ptr<network::ChannelPool> channels,
+          size_t proposal_fanout,
+          ordering::QueueLimits queue_limits = ordering::QueueLimits(),
+          boost::optional<ordering::ProposalBounds> proposal_bounds =
+              boost::none);
 
       std::shared_ptr<iroha::network::OrderingService> ordering_service;
       std::shared_ptr<iroha::network::OrderingGate> ordering_gate;
@@ -17,14 +17,18 @@
 
 #include <gflags/gflags.h>
 #include <grpc++/grpc++.h>
+#include <atomic>
 #include <csignal>
 #include <fstream>
+#include <future>
+#include <map>
 #include <thread>
 #include "common/result.hpp"
 #include "crypto/keys_manager_impl.hpp"
 #include "main/application.hpp"
 #include "main/iroha_conf_loader.hpp"
 #include "main/raw_block_loader.hpp"
+#include "metrics/round_metrics.hpp"
 
 /**
  * Gflag validator.
@@ -78,7 +82,91 @@ DEFINE_validator(keypair_name, &validate_keypair_name);
  */
 DEFINE_bool(overwrite_ledger, false, "Overwrite ledger data if existing");
 
+/**
+ * Creating input argument for the file with consensus round metrics.
+ * Metrics are written in JSON on SIGUSR1 and on shutdown
+ */
+DEFINE_string(metrics_file, "", "Specify file to dump round metrics to");
+
+/**
+ * Creating boolean flag for bootstrapping ledger from a checkpoint of other
+ * peers instead of applying all blocks from genesis
+ */
+DEFINE_bool(fast_sync, false, "Bootstrap ledger from checkpoint of peers");
+
+/**
+ * Creating input argument for the number of peers to which ordering service
+ * sends proposal, other peers receive it along the tree of relaying peers
+ */
+DEFINE_uint64(proposal_fanout,
+              0,
+              "Relay proposals along a tree with given fanout, proposals are "
+              "sent to every peer directly if 0");
+
+/**
+ * Creating input argument for the capacity of the queue of ordering service
+ */
+DEFINE_uint64(ordering_queue_size,
+              0,
+              "Maximum number of transactions in the queue of ordering "
+              "service, unbounded if 0");
+
+/**
+ * Policies of the queue of ordering service by their names
+ */
+const std::map<std::string, iroha::ordering::QueuePolicy> queue_policies = {
+    {"reject", iroha::ordering::QueuePolicy::kReject},
+    {"drop_oldest", iroha::ordering::QueuePolicy::kDropOldest},
+    {"fair_share", iroha::ordering::QueuePolicy::kFairShare}};
+
+/**
+ * Gflag validator.
+ * Validator for the policy of the queue of ordering service.
+ * @param flag_name - flag name. Must be 'ordering_queue_policy' in this case
+ * @param policy - name of the policy
+ * @return true if the policy is known
+ */
+bool validate_queue_policy(const char *flag_name, std::string const &policy) {
+  return queue_policies.count(policy) != 0;
+}
+
+/**
+ * Creating input argument for the policy applied when a batch does not fit
+ * into the queue of ordering service
+ */
+DEFINE_string(ordering_queue_policy,
+              "reject",
+              "Policy of the full ordering queue: reject, drop_oldest or "
+              "fair_share");
+/**
+ * Registering validator for the policy of the queue of ordering service.
+ */
+DEFINE_validator(ordering_queue_policy, &validate_queue_policy);
+
+/**
+ * Creating input argument for the latency targeted by adaptive proposal sizing
+ */
+DEFINE_uint64(proposal_latency_target,
+              0,
+              "Time in milliseconds from arrival of transaction to commit "
+              "which ordering service tries to keep by tuning proposal size "
+              "and delay, fixed max_proposal_size and proposal_delay are used "
+              "if 0");
+
+/**
+ * Creating input arguments for the lower bounds of adaptive proposal sizing,
+ * the upper bounds are max_proposal_size and proposal_delay
+ */
+DEFINE_uint64(min_proposal_size,
+              1,
+              "Minimum size of proposal with adaptive proposal sizing");
+DEFINE_uint64(min_proposal_delay,
+              10,
+              "Minimum delay in milliseconds between proposals with adaptive "
+              "proposal sizing");
+
 std::promise<void> exit_requested;
+std::atomic<bool> metrics_requested{false};
 
 int main(int argc, char *argv[]) {
   auto log = logger::log("MAIN");
@@ -112,6 +200,16 @@ int main(int argc, char *argv[]) {
     return EXIT_FAILURE;
   }
 
+  boost::optional<iroha::ordering::ProposalBounds> proposal_bounds;
+  if (FLAGS_proposal_latency_target != 0) {
+    proposal_bounds = iroha::ordering::ProposalBounds{
+        FLAGS_min_proposal_size,
+        config[mbr::MaxProposalSize].GetUint(),
+        std::chrono::milliseconds(FLAGS_min_proposal_delay),
+        std::chrono::milliseconds(config[mbr::ProposalDelay].GetUint()),
+        std::chrono::milliseconds(FLAGS_proposal_latency_target)};
+  }
+
   // Configuring iroha daemon
   Irohad irohad(config[mbr::BlockStorePath].GetString(),
                 config[mbr::PgOpt].GetString(),
@@ -122,7 +220,13 @@ int main(int argc, char *argv[]) {
                 std::chrono::milliseconds(config[mbr::VoteDelay].GetUint()),
                 std::chrono::milliseconds(config[mbr::LoadDelay].GetUint()),
                 *keypair,
-                config[mbr::MstSupport].GetBool());
+                config[mbr::MstSupport].GetBool(),
+                FLAGS_fast_sync,
+                FLAGS_proposal_fanout,
+                iroha::ordering::QueueLimits{
+                    FLAGS_ordering_queue_size,
+                    queue_policies.at(FLAGS_ordering_queue_policy)},
+                proposal_bounds);
 
   // Check if iroha daemon storage was successfully initialized
   if (not irohad.storage) {
@@ -189,11 +293,28 @@ int main(int argc, char *argv[]) {
   std::signal(SIGINT, handler);
   std::signal(SIGTERM, handler);
   std::signal(SIGQUIT, handler);
+  std::signal(SIGUSR1, [](int) { metrics_requested = true; });
+
+  auto dump_metrics = [&log] {
+    if (FLAGS_metrics_file.empty()) {
+      return;
+    }
+    std::ofstream file(FLAGS_metrics_file);
+    file << iroha::metrics::roundMetrics().toJson();
+    log->info("Round metrics are written to {}", FLAGS_metrics_file);
+  };
 
   // runs iroha
   log->info("Running iroha");
   irohad.run();
-  exit_requested.get_future().wait();
+  auto exit_future = exit_requested.get_future();
+  while (exit_future.wait_for(std::chrono::seconds(1))
+         == std::future_status::timeout) {
+    if (metrics_requested.exchange(false)) {
+      dump_metrics();
+    }
+  }
+  dump_metrics();
 
   // We do not care about shutting down grpc servers
   // They do all necessary work in their destructors
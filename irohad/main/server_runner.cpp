@@ -20,6 +20,8 @@
 #include <boost/format.hpp>
 
 const auto kPortBindError = "Cannot bind server to address %s";
+// long-lived streams are cancelled when deadline expires
+const auto kShutdownDeadline = std::chrono::seconds(1);
 
 ServerRunner::ServerRunner(const std::string &address, bool reuse)
     : serverAddress_(address), reuse_(reuse) {}
@@ -68,6 +70,7 @@ void ServerRunner::waitForServersReady() {
 
 void ServerRunner::shutdown() {
   if (serverInstance_) {
-    serverInstance_->Shutdown();
+    serverInstance_->Shutdown(std::chrono::system_clock::now()
+                              + kShutdownDeadline);
   }
 }
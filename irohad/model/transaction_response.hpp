@@ -34,6 +34,8 @@ namespace iroha {
         COMMITTED,
         /// tx is expired in mst validation
         MST_EXPIRED,
+        /// tx is not accepted to the queue of ordering service
+        ORDERING_REJECTED,
         /// transaction is not in handler map
         NOT_RECEIVED,
       };
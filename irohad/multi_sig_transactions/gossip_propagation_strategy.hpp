@@ -24,6 +24,7 @@
 #include <chrono>
 #include <mutex>
 #include "ametsuchi/peer_query.hpp"
+#include "timer/timer_wheel.hpp"
 
 namespace iroha {
 
@@ -42,10 +43,12 @@ namespace iroha {
      * @param query is a provider of peer list
      * @param period of emitting data in ms
      * @param amount of peers emitted per once
+     * @param timer_wheel drives the emitting
      */
     GossipPropagationStrategy(PeerProvider query,
                               std::chrono::milliseconds period,
-                              uint32_t amount);
+                              uint32_t amount,
+                              std::shared_ptr<timer::TimerWheel> timer_wheel);
 
     ~GossipPropagationStrategy();
 
@@ -23,20 +23,22 @@
 #include <boost/assert.hpp>
 #include <boost/range/irange.hpp>
 #include "common/types.hpp"
+#include "timer/rx_timer.hpp"
 
 namespace iroha {
 
   using PropagationData = PropagationStrategy::PropagationData;
   using OptPeer = GossipPropagationStrategy::OptPeer;
   using PeerProvider = GossipPropagationStrategy::PeerProvider;
-  using std::chrono::steady_clock;
-
   GossipPropagationStrategy::GossipPropagationStrategy(
-      PeerProvider query, std::chrono::milliseconds period, uint32_t amount)
+      PeerProvider query,
+      std::chrono::milliseconds period,
+      uint32_t amount,
+      std::shared_ptr<timer::TimerWheel> timer_wheel)
       : query(query),
         non_visited({}),
-        emitent(rxcpp::observable<>::interval(steady_clock::now(), period)
-                    .map([this, amount](int) {
+        emitent(timer::makeInterval(std::move(timer_wheel), period)
+                    .map([this, amount](long) {
                       PropagationData vec;
                       auto range = boost::irange(0u, amount);
                       // push until find empty element
@@ -51,7 +53,8 @@ namespace iroha {
                     })) {}
 
   rxcpp::observable<PropagationData> GossipPropagationStrategy::emitter() {
-    return emitent.subscribe_on(rxcpp::observe_on_new_thread());
+    // values are emitted on the thread of the timer wheel
+    return emitent;
   }
 
   GossipPropagationStrategy::~GossipPropagationStrategy() {
@@ -99,6 +99,18 @@ namespace iroha {
     shareState(expired_transactions, this->expired_subject_);
   }
 
+  TransactionHashes FairMstProcessor::onSummary(const MstSummary &summary) {
+    auto missing = storage_->whatsMissing(summary);
+    log_->info("Requesting {} of {} txes", missing.size(), summary.size());
+    return missing;
+  }
+
+  void FairMstProcessor::onSendFailed(
+      const shared_model::interface::Peer &to) {
+    log_->warn("State was not delivered to {}, resending it", to.address());
+    storage_->resetPropagation(to);
+  }
+
   // -----------------------------| private api |-----------------------------
 
   void FairMstProcessor::onPropagate(
@@ -107,7 +119,7 @@ namespace iroha {
     auto current_time = time_provider_->getCurrentTime();
     std::for_each(
         data.begin(), data.end(), [this, &current_time](const auto &peer) {
-          auto diff = storage_->getDiffState(peer, current_time);
+          auto diff = storage_->getPropagationState(peer, current_time);
           if (not diff.isEmpty()) {
             transport_->sendState(*peer, diff);
           }
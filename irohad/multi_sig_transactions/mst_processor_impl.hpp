@@ -66,6 +66,10 @@ namespace iroha {
     void onNewState(const std::shared_ptr<shared_model::interface::Peer> &from,
                     ConstRefState new_state) override;
 
+    TransactionHashes onSummary(const MstSummary &summary) override;
+
+    void onSendFailed(const shared_model::interface::Peer &to) override;
+
     // ----------------------------| end override |-----------------------------
 
    private:
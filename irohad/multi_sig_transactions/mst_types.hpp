@@ -19,6 +19,8 @@
 #define IROHA_MST_TYPES_HPP
 
 #include <memory>
+#include <vector>
+#include "cryptography/hash.hpp"
 #include "interfaces/common_objects/peer.hpp"
 #include "interfaces/common_objects/types.hpp"
 #include "interfaces/transaction.hpp"
@@ -43,5 +45,17 @@ namespace iroha {
   using ConstRefState = ConstRefT<MstState>;
 
   using DataType = SharedTx;
+
+  /**
+   * Transaction of state as it is described to other peers
+   */
+  struct TransactionSummary {
+    shared_model::crypto::Hash hash;
+    /// fingerprint of the set of public keys of transaction signatures
+    uint64_t signatures;
+  };
+
+  using MstSummary = std::vector<TransactionSummary>;
+  using TransactionHashes = std::vector<shared_model::crypto::Hash>;
 }  // namespace iroha
 #endif  // IROHA_MST_TYPES_HPP
@@ -17,14 +17,32 @@
 
 #include "multi_sig_transactions/state/mst_state.hpp"
 
+#include <boost/functional/hash.hpp>
 #include <boost/range/algorithm/find.hpp>
+#include <unordered_map>
 #include <utility>
 
 #include "backend/protobuf/transaction.hpp"
+#include "common/cloneable.hpp"
 #include "common/set.hpp"
 
 namespace iroha {
 
+  namespace {
+    /**
+     * Fingerprint does not depend on order of signatures, and differs for
+     * sets of different keys with high probability
+     */
+    uint64_t signaturesFingerprint(const DataType &tx) {
+      uint64_t fingerprint = boost::size(tx->signatures());
+      for (auto &sig : tx->signatures()) {
+        const auto &key = sig.publicKey().blob();
+        fingerprint ^= boost::hash_range(key.begin(), key.end());
+      }
+      return fingerprint;
+    }
+  }  // namespace
+
   // ------------------------------| public api |-------------------------------
 
   MstState MstState::empty(const CompleterType &completer) {
@@ -76,13 +94,64 @@ namespace iroha {
                                  internal_state_.end());
   }
 
+  DataType MstState::find(const DataType &tx) const {
+    auto iter = internal_state_.find(tx);
+    return iter == internal_state_.end() ? nullptr : *iter;
+  }
+
+  bool MstState::contains(const DataType &tx) const {
+    auto found = find(tx);
+    if (not found) {
+      return false;
+    }
+    for (auto &sig : tx->signatures()) {
+      if (boost::find(found->signatures(), sig)
+          == boost::end(found->signatures())) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  MstSummary MstState::summary() const {
+    MstSummary summary;
+    summary.reserve(internal_state_.size());
+    for (const auto &tx : internal_state_) {
+      summary.push_back({tx->hash(), signaturesFingerprint(tx)});
+    }
+    return summary;
+  }
+
+  TransactionHashes MstState::missing(const MstSummary &summary) const {
+    std::unordered_map<shared_model::crypto::Hash,
+                       uint64_t,
+                       shared_model::crypto::Hash::Hasher>
+        fingerprints;
+    for (const auto &tx : internal_state_) {
+      fingerprints.emplace(tx->hash(), signaturesFingerprint(tx));
+    }
+
+    TransactionHashes hashes;
+    for (const auto &tx : summary) {
+      auto fingerprint = fingerprints.find(tx.hash);
+      if (fingerprint == fingerprints.end()
+          or fingerprint->second != tx.signatures) {
+        hashes.push_back(tx.hash);
+      }
+    }
+    return hashes;
+  }
+
   MstState MstState::eraseByTime(const TimeType &time) {
     MstState out = MstState::empty(completer_);
     while (not index_.empty() and (*completer_)(index_.top(), time)) {
+      // completed transactions are already erased from the state, but stay
+      // in the index
       auto iter = internal_state_.find(index_.top());
-
-      out += *iter;
-      internal_state_.erase(iter);
+      if (iter != internal_state_.end()) {
+        out.rawInsert(*iter);
+        internal_state_.erase(iter);
+      }
       index_.pop();
     }
     return out;
@@ -97,9 +166,7 @@ namespace iroha {
                      const InternalStateType &transactions)
       : completer_(completer),
         internal_state_(transactions.begin(), transactions.end()),
-        index_(transactions.begin(), transactions.end()) {
-    log_ = logger::log("MstState");
-  }
+        index_(transactions.begin(), transactions.end()) {}
 
   void MstState::insertOne(MstState &out_state, const DataType &rhs_tx) {
     auto corresponding = internal_state_.find(rhs_tx);
@@ -109,19 +176,31 @@ namespace iroha {
       return;
     }
 
-    auto &found = *corresponding;
-    // Append new signatures to the existing state
+    auto found = *corresponding;
+    // transactions of the state are read by other threads, so new
+    // signatures are appended to a copy which replaces the existing one
+    DataType updated;
     for (auto &sig : rhs_tx->signatures()) {
-      if (boost::find(found->signatures(), sig) == boost::end(found->signatures())) {
-        found->addSignature(sig.signedData(), sig.publicKey());
+      if (boost::find(found->signatures(), sig)
+          == boost::end(found->signatures())) {
+        if (not updated) {
+          updated = clone(*found);
+        }
+        updated->addSignature(sig.signedData(), sig.publicKey());
       }
     }
+    if (updated) {
+      // time index finds transactions by hash, so it keeps the old copy
+      internal_state_.erase(corresponding);
+      corresponding = internal_state_.insert(updated).first;
+      found = std::move(updated);
+    }
 
     if ((*completer_)(found)) {
       // state already has completed transaction,
       // remove from state and return it
-      out_state += found;
-      internal_state_.erase(internal_state_.find(found));
+      out_state.rawInsert(found);
+      internal_state_.erase(corresponding);
     }
   }
 
@@ -21,7 +21,6 @@
 #include <queue>
 #include <unordered_set>
 #include <vector>
-#include "logger/logger.hpp"
 
 #include "multi_sig_transactions/hash.hpp"
 #include "multi_sig_transactions/mst_types.hpp"
@@ -129,6 +128,30 @@ namespace iroha {
      */
     std::vector<DataType> getTransactions() const;
 
+    /**
+     * @param tx - transaction to look for
+     * @return transaction of the state with the same hash, nullptr if absent
+     */
+    DataType find(const DataType &tx) const;
+
+    /**
+     * @param tx - transaction to look for
+     * @return true if the state has the transaction with all its signatures
+     */
+    bool contains(const DataType &tx) const;
+
+    /**
+     * @return hashes and signature fingerprints of transactions of the state
+     */
+    MstSummary summary() const;
+
+    /**
+     * @param summary - summary of state of other peer
+     * @return hashes of transactions of the summary which the state does not
+     * have, or has with other signatures
+     */
+    TransactionHashes missing(const MstSummary &summary) const;
+
     /**
      * Erase expired transactions
      * @param time - current time
@@ -182,8 +205,6 @@ namespace iroha {
     InternalStateType internal_state_;
 
     IndexType index_;
-
-    logger::Logger log_;
   };
 
 }  // namespace iroha
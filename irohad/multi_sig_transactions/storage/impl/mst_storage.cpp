@@ -48,8 +48,26 @@ namespace iroha {
     return getDiffStateImpl(target_peer, current_time);
   }
 
+  MstState MstStorage::getPropagationState(
+      const std::shared_ptr<shared_model::interface::Peer> &target_peer,
+      const TimeType &current_time) {
+    std::lock_guard<std::mutex> lock{this->mutex_};
+    return getPropagationStateImpl(target_peer, current_time);
+  }
+
+  void MstStorage::resetPropagation(
+      const shared_model::interface::Peer &target_peer) {
+    std::lock_guard<std::mutex> lock{this->mutex_};
+    resetPropagationImpl(target_peer);
+  }
+
   MstState MstStorage::whatsNew(ConstRefState new_state) const {
     std::lock_guard<std::mutex> lock{this->mutex_};
     return whatsNewImpl(new_state);
   }
+
+  TransactionHashes MstStorage::whatsMissing(const MstSummary &summary) const {
+    std::lock_guard<std::mutex> lock{this->mutex_};
+    return whatsMissingImpl(summary);
+  }
 }  // namespace iroha
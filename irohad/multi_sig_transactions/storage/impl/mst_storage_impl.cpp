@@ -17,6 +17,10 @@
 
 #include "multi_sig_transactions/storage/mst_storage_impl.hpp"
 
+#include <algorithm>
+#include <boost/range/size.hpp>
+#include "common/cloneable.hpp"
+
 namespace iroha {
   // ------------------------------| private API |------------------------------
 
@@ -29,6 +33,36 @@ namespace iroha {
     }
     return target_state_iter;
   }
+
+  MstStorageStateImpl::PeerView &MstStorageStateImpl::getView(
+      const shared_model::interface::Peer &target_peer) {
+    return peer_views_[target_peer.pubkey().hex()];
+  }
+
+  void MstStorageStateImpl::touch(const DataType &tx) {
+    // completed transaction is not in own state anymore
+    auto own_tx = own_state_.find(tx);
+    if (not own_tx) {
+      return;
+    }
+    auto &version = versions_[tx->hash()];
+    changes_.erase(version);
+    version = ++version_;
+    changes_.emplace(version, std::move(own_tx));
+  }
+
+  void MstStorageStateImpl::forget(ConstRefState state) {
+    for (const auto &tx : state.getTransactions()) {
+      auto version = versions_.find(tx->hash());
+      if (version != versions_.end()) {
+        changes_.erase(version->second);
+        versions_.erase(version);
+      }
+      for (auto &view : peer_views_) {
+        view.second.known.erase(tx->hash());
+      }
+    }
+  }
   // -----------------------------| interface API |-----------------------------
 
   MstStorageStateImpl::MstStorageStateImpl(const CompleterType &completer)
@@ -41,18 +75,39 @@ namespace iroha {
       const MstState &new_state) -> decltype(apply(target_peer, new_state)) {
     auto target_state_iter = getState(target_peer);
     target_state_iter->second += new_state;
-    return own_state_ += new_state;
+
+    auto &view = getView(*target_peer);
+    std::vector<DataType> changed;
+    for (const auto &tx : new_state.getTransactions()) {
+      auto &known = view.known[tx->hash()];
+      known = std::max<size_t>(known, boost::size(tx->signatures()));
+      if (not own_state_.contains(tx)) {
+        changed.push_back(tx);
+      }
+    }
+
+    auto completed = own_state_ += new_state;
+    for (const auto &tx : changed) {
+      touch(tx);
+    }
+    forget(completed);
+    return completed;
   }
 
   auto MstStorageStateImpl::updateOwnStateImpl(const DataType &tx)
       -> decltype(updateOwnState(tx)) {
-    return own_state_ += tx;
+    auto completed = own_state_ += tx;
+    touch(tx);
+    forget(completed);
+    return completed;
   }
 
   auto MstStorageStateImpl::getExpiredTransactionsImpl(
       const TimeType &current_time)
       -> decltype(getExpiredTransactions(current_time)) {
-    return own_state_.eraseByTime(current_time);
+    auto expired = own_state_.eraseByTime(current_time);
+    forget(expired);
+    return expired;
   }
 
   auto MstStorageStateImpl::getDiffStateImpl(
@@ -65,9 +120,49 @@ namespace iroha {
     return new_diff_state;
   }
 
+  auto MstStorageStateImpl::getPropagationStateImpl(
+      const std::shared_ptr<shared_model::interface::Peer> target_peer,
+      const TimeType &current_time)
+      -> decltype(getPropagationState(target_peer, current_time)) {
+    auto &view = getView(*target_peer);
+    auto state = MstState::empty(completer_);
+    for (auto change = changes_.upper_bound(view.propagated);
+         change != changes_.end();
+         ++change) {
+      const auto &tx = change->second;
+      if ((*completer_)(tx, current_time)) {
+        continue;
+      }
+      // signatures are only added, so the peer which has as many signatures
+      // as own transaction has all of them
+      auto signatures = boost::size(tx->signatures());
+      auto &known = view.known[tx->hash()];
+      if (known >= signatures) {
+        continue;
+      }
+      known = signatures;
+      // state is sent without the lock, while own transactions can be
+      // replaced with newly signed ones
+      state += clone(*tx);
+    }
+    view.propagated = version_;
+    return state;
+  }
+
+  auto MstStorageStateImpl::resetPropagationImpl(
+      const shared_model::interface::Peer &target_peer)
+      -> decltype(resetPropagation(target_peer)) {
+    peer_views_.erase(target_peer.pubkey().hex());
+  }
+
   auto MstStorageStateImpl::whatsNewImpl(ConstRefState new_state) const
       -> decltype(whatsNew(new_state)) {
     return new_state - own_state_;
   }
 
+  auto MstStorageStateImpl::whatsMissingImpl(const MstSummary &summary) const
+      -> decltype(whatsMissing(summary)) {
+    return own_state_.missing(summary);
+  }
+
 }  // namespace iroha
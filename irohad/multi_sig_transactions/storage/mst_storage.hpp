@@ -71,6 +71,24 @@ namespace iroha {
         const std::shared_ptr<shared_model::interface::Peer> &target_peer,
         const TimeType &current_time);
 
+    /**
+     * Make state of own transactions which changed since the previous
+     * propagation to the peer and are not known to it, and remember them as
+     * propagated. Expired transactions are not included.
+     * @return state of copies of own transactions to be sent to the peer
+     * General note: implementation of method covered by lock
+     */
+    MstState getPropagationState(
+        const std::shared_ptr<shared_model::interface::Peer> &target_peer,
+        const TimeType &current_time);
+
+    /**
+     * Forget propagations to the peer, e.g. when they were not delivered, so
+     * that the next propagation contains the whole own state
+     * General note: implementation of method covered by lock
+     */
+    void resetPropagation(const shared_model::interface::Peer &target_peer);
+
     /**
      * Return diff between own and new state
      * @param new_state - state with new data
@@ -79,6 +97,15 @@ namespace iroha {
      */
     MstState whatsNew(ConstRefState new_state) const;
 
+    /**
+     * Return transactions which should be requested from peer
+     * @param summary - summary of state of the peer
+     * @return hashes of transactions which own state does not have, or has
+     * with other signatures
+     * General note: implementation of method covered by lock
+     */
+    TransactionHashes whatsMissing(const MstSummary &summary) const;
+
     virtual ~MstStorage() = default;
 
    protected:
@@ -106,9 +133,21 @@ namespace iroha {
         const TimeType &current_time)
         -> decltype(getDiffState(target_peer, current_time)) = 0;
 
+    virtual auto getPropagationStateImpl(
+        const std::shared_ptr<shared_model::interface::Peer> target_peer,
+        const TimeType &current_time)
+        -> decltype(getPropagationState(target_peer, current_time)) = 0;
+
+    virtual auto resetPropagationImpl(
+        const shared_model::interface::Peer &target_peer)
+        -> decltype(resetPropagation(target_peer)) = 0;
+
     virtual auto whatsNewImpl(ConstRefState new_state) const
         -> decltype(whatsNew(new_state)) = 0;
 
+    virtual auto whatsMissingImpl(const MstSummary &summary) const
+        -> decltype(whatsMissing(summary)) = 0;
+
     // -------------------------------| fields |--------------------------------
 
     mutable std::mutex mutex_;
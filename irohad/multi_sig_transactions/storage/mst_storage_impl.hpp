@@ -18,7 +18,9 @@
 #ifndef IROHA_MST_STORAGE_IMPL_HPP
 #define IROHA_MST_STORAGE_IMPL_HPP
 
+#include <map>
 #include <unordered_map>
+#include "cryptography/hash.hpp"
 #include "multi_sig_transactions/hash.hpp"
 #include "multi_sig_transactions/storage/mst_storage.hpp"
 
@@ -35,6 +37,36 @@ namespace iroha {
     auto getState(
         const std::shared_ptr<shared_model::interface::Peer> target_peer);
 
+    /**
+     * What is known about own transactions held by a peer
+     */
+    struct PeerView {
+      /// version of own state propagated to the peer
+      uint64_t propagated = 0;
+      /// number of signatures of transactions which the peer has received
+      /// from this peer or sent to it
+      std::unordered_map<shared_model::crypto::Hash,
+                         size_t,
+                         shared_model::crypto::Hash::Hasher>
+          known;
+    };
+
+    /**
+     * @return view of the peer, empty if the peer is new
+     */
+    PeerView &getView(const shared_model::interface::Peer &target_peer);
+
+    /**
+     * Assign next version of own state to the transaction after it was added
+     * or got new signatures
+     */
+    void touch(const DataType &tx);
+
+    /**
+     * Drop versions of transactions which left own state
+     */
+    void forget(ConstRefState state);
+
    public:
     // ----------------------------| interface API |----------------------------
     explicit MstStorageStateImpl(const CompleterType &completer);
@@ -55,9 +87,20 @@ namespace iroha {
         const TimeType &current_time)
         -> decltype(getDiffState(target_peer, current_time)) override;
 
+    auto getPropagationStateImpl(
+        const std::shared_ptr<shared_model::interface::Peer> target_peer,
+        const TimeType &current_time)
+        -> decltype(getPropagationState(target_peer, current_time)) override;
+
+    auto resetPropagationImpl(const shared_model::interface::Peer &target_peer)
+        -> decltype(resetPropagation(target_peer)) override;
+
     auto whatsNewImpl(ConstRefState new_state) const
         -> decltype(whatsNew(new_state)) override;
 
+    auto whatsMissingImpl(const MstSummary &summary) const
+        -> decltype(whatsMissing(summary)) override;
+
    private:
     // ---------------------------| private fields |----------------------------
 
@@ -67,6 +110,18 @@ namespace iroha {
                        iroha::model::PeerHasher>
         peer_states_;
     MstState own_state_;
+
+    /// version of the last change of own state
+    uint64_t version_ = 0;
+    /// transactions of own state by versions of their last changes
+    std::map<uint64_t, DataType> changes_;
+    /// versions of the last changes of transactions of own state
+    std::unordered_map<shared_model::crypto::Hash,
+                       uint64_t,
+                       shared_model::crypto::Hash::Hasher>
+        versions_;
+    /// views of peers by their public keys
+    std::unordered_map<std::string, PeerView> peer_views_;
   };
 }  // namespace iroha
 
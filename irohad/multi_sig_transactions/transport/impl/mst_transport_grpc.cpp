@@ -16,15 +16,42 @@
  */
 
 #include "multi_sig_transactions/transport/mst_transport_grpc.hpp"
+
 #include "backend/protobuf/transaction.hpp"
 #include "builders/protobuf/common_objects/proto_peer_builder.hpp"
 #include "builders/protobuf/transport_builder.hpp"
+#include "common/cloneable.hpp"
 #include "validators/default_validator.hpp"
 
 using namespace iroha::network;
 
-MstTransportGrpc::MstTransportGrpc()
-    : AsyncGrpcClient<google::protobuf::Empty>(logger::log("MstTransport")) {}
+MstTransportGrpc::MstTransportGrpc(
+    std::shared_ptr<ChannelPool> channels,
+    std::shared_ptr<shared_model::interface::Peer> my_peer)
+    : AsyncGrpcClient<google::protobuf::Empty>(logger::log("MstTransport"),
+                                               std::move(channels)),
+      summary_client_(logger::log("MstTransportSummary"), channels_),
+      my_peer_(std::move(my_peer)) {}
+
+grpc::Status MstTransportGrpc::SendSummary(
+    ::grpc::ServerContext *context,
+    const ::iroha::network::transport::MstSummary *request,
+    ::iroha::network::transport::MstRequest *response) {
+  MstSummary summary;
+  summary.reserve(request->transactions_size());
+  for (const auto &tx : request->transactions()) {
+    summary.push_back({shared_model::crypto::Hash(tx.hash()), tx.signatures()});
+  }
+
+  for (const auto &hash : subscriber_.lock()->onSummary(summary)) {
+    response->add_hashes(shared_model::crypto::toBinaryString(hash));
+  }
+  log_->info("Requested {} of {} transactions",
+             response->hashes_size(),
+             request->transactions_size());
+
+  return grpc::Status::OK;
+}
 
 grpc::Status MstTransportGrpc::SendState(
     ::grpc::ServerContext *context,
@@ -69,23 +96,75 @@ void MstTransportGrpc::subscribe(
 void MstTransportGrpc::sendState(const shared_model::interface::Peer &to,
                                  ConstRefState providing_state) {
   log_->info("Propagate MstState to peer {}", to.address());
-  auto client = transport::MstTransportGrpc::NewStub(
-      grpc::CreateChannel(to.address(), grpc::InsecureChannelCredentials()));
+  auto client = channels_->client<transport::MstTransportGrpc>(to);
 
-  auto call = new AsyncClientCall;
+  std::shared_ptr<shared_model::interface::Peer> peer = clone(to);
+  // state is propagated incrementally, so the lost one should be resent
+  std::function<void()> on_failure = [subscriber = subscriber_, peer] {
+    if (auto notification = subscriber.lock()) {
+      notification->onSendFailed(*peer);
+    }
+  };
 
-  transport::MstState protoState;
-  auto peer = protoState.mutable_peer();
-  peer->set_peer_key(shared_model::crypto::toBinaryString(to.pubkey()));
-  peer->set_address(to.address());
-  for (auto &tx : providing_state.getTransactions()) {
-    auto addtxs = protoState.add_transactions();
+  transport::MstSummary summary;
+  for (const auto &tx : providing_state.summary()) {
+    auto added = summary.add_transactions();
+    added->set_hash(shared_model::crypto::toBinaryString(tx.hash));
+    added->set_signatures(tx.signatures);
+  }
+
+  // transactions are taken from the state before the reply is awaited, so
+  // that the completion thread does not hold the state of the caller
+  auto transactions = std::make_shared<TransportsByHash>();
+  for (const auto &tx : providing_state.getTransactions()) {
     // TODO (@l4l) 04/03/18 simplify with IR-1040
-    new (addtxs) protocol::Transaction(
+    transactions->emplace(
+        shared_model::crypto::toBinaryString(tx->hash()),
         std::static_pointer_cast<shared_model::proto::Transaction>(tx)
             ->getTransport());
   }
 
+  // transactions are sent when the peer replies which of them it misses
+  auto call =
+      new AsyncGrpcClient<transport::MstRequest>::AsyncClientCall;
+  call->address = to.address();
+  call->on_failure = on_failure;
+  call->on_success = [this, peer, transactions, on_failure](
+                         const transport::MstRequest &request) {
+    this->sendTransactions(*peer, *transactions, request, on_failure);
+  };
+
+  call->response_reader =
+      client->AsyncSendSummary(&call->context, summary, &summary_client_.cq_);
+  call->response_reader->Finish(&call->reply, &call->status, call);
+}
+
+void MstTransportGrpc::sendTransactions(
+    const shared_model::interface::Peer &to,
+    const TransportsByHash &transactions,
+    const transport::MstRequest &request,
+    std::function<void()> on_failure) {
+  if (request.hashes().empty()) {
+    return;
+  }
+
+  auto call = new AsyncClientCall;
+  call->address = to.address();
+  call->on_failure = std::move(on_failure);
+
+  // the recipient records the state as the one of the sender
+  transport::MstState protoState;
+  auto peer = protoState.mutable_peer();
+  peer->set_peer_key(shared_model::crypto::toBinaryString(my_peer_->pubkey()));
+  peer->set_address(my_peer_->address());
+  for (const auto &hash : request.hashes()) {
+    auto tx = transactions.find(hash);
+    if (tx != transactions.end()) {
+      *protoState.add_transactions() = tx->second;
+    }
+  }
+
+  auto client = channels_->client<transport::MstTransportGrpc>(to);
   call->response_reader =
       client->AsyncSendState(&call->context, protoState, &cq_);
   call->response_reader->Finish(&call->reply, &call->status, call);
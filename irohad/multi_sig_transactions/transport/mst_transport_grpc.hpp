@@ -19,6 +19,8 @@
 #define IROHA_MST_TRANSPORT_GRPC_HPP
 
 #include <google/protobuf/empty.pb.h>
+#include <functional>
+#include <unordered_map>
 #include "logger/logger.hpp"
 #include "model/converters/pb_transaction_factory.hpp"
 #include "mst.grpc.pb.h"
@@ -31,7 +33,25 @@ namespace iroha {
                              public transport::MstTransportGrpc::Service,
                              private AsyncGrpcClient<google::protobuf::Empty> {
      public:
-      MstTransportGrpc();
+      /**
+       * @param channels - pool of channels to other peers
+       * @param my_peer - this peer, which is reported to recipients of states
+       * as their sender
+       */
+      MstTransportGrpc(std::shared_ptr<ChannelPool> channels,
+                       std::shared_ptr<shared_model::interface::Peer> my_peer);
+
+      /**
+       * Server part of grpc SendSummary method call
+       * @param context - server context with information about call
+       * @param request - summary of state which the peer is going to send
+       * @param response - hashes of transactions which should be sent
+       * @return grpc::Status (always OK)
+       */
+      grpc::Status SendSummary(
+          ::grpc::ServerContext *context,
+          const ::iroha::network::transport::MstSummary *request,
+          ::iroha::network::transport::MstRequest *response) override;
 
       /**
        * Server part of grpc SendState method call
@@ -52,6 +72,26 @@ namespace iroha {
                      ConstRefState providing_state) override;
 
      private:
+      /// transports of transactions by their binary hashes
+      using TransportsByHash =
+          std::unordered_map<std::string, protocol::Transaction>;
+
+      /**
+       * Send transactions requested by the peer in reply to the summary
+       * @param to - peer recipient of transactions
+       * @param transactions - transports of transactions of the summarized
+       * state
+       * @param request - reply of the peer to the summary
+       * @param on_failure - handler of failed send
+       */
+      void sendTransactions(const shared_model::interface::Peer &to,
+                            const TransportsByHash &transactions,
+                            const transport::MstRequest &request,
+                            std::function<void()> on_failure);
+
+      /// client of summaries, which have replies unlike states
+      AsyncGrpcClient<transport::MstRequest> summary_client_;
+      std::shared_ptr<shared_model::interface::Peer> my_peer_;
       std::weak_ptr<MstTransportNotification> subscriber_;
       model::converters::PbTransactionFactory factory_;
     };
@@ -20,13 +20,23 @@
 
 #include <memory>
 #include <rxcpp/rx-observable.hpp>
+#include <vector>
 
 #include "cryptography/public_key.hpp"
 #include "interfaces/common_objects/types.hpp"
 #include "interfaces/iroha_internal/block.hpp"
+#include "network/checkpoint.hpp"
 
 namespace iroha {
   namespace network {
+    /**
+     * Block together with the peer which sent it
+     */
+    struct LoadedBlock {
+      shared_model::crypto::PublicKey peer;
+      std::shared_ptr<shared_model::interface::Block> block;
+    };
+
     /**
      * Interface for downloading blocks from a network
      */
@@ -40,6 +50,20 @@ namespace iroha {
       virtual rxcpp::observable<std::shared_ptr<shared_model::interface::Block>>
       retrieveBlocks(const shared_model::crypto::PublicKey &peer_pubkey) = 0;
 
+      /**
+       * Retrieve blocks from current top up to given height. Missing heights
+       * are split into ranges which are downloaded from the peers in
+       * parallel, range failed on one peer is retried on other ones
+       * @param peer_pubkeys - peers for requesting blocks
+       * @param height - height of the last requested block
+       * @return blocks in order of height with the peers which sent them,
+       * observable completes before given height if some range cannot be
+       * retrieved from any of the peers, or when it is unsubscribed
+       */
+      virtual rxcpp::observable<LoadedBlock> retrieveBlocks(
+          const std::vector<shared_model::crypto::PublicKey> &peer_pubkeys,
+          shared_model::interface::types::HeightType height) = 0;
+
       /**
        * Retrieve block by its block_hash from given peer
        * @param peer_pubkey - peer for requesting blocks
@@ -52,6 +76,16 @@ namespace iroha {
           const shared_model::crypto::PublicKey &peer_pubkey,
           const shared_model::interface::types::HashType &block_hash) = 0;
 
+      /**
+       * Retrieve latest checkpoint of the storage from given peer
+       * @param peer - peer for requesting checkpoint, which may be unknown to
+       * the local ledger
+       * @return checkpoint with valid signature of the peer, nullopt on
+       * failure
+       */
+      virtual boost::optional<Checkpoint> retrieveCheckpoint(
+          const shared_model::interface::Peer &peer) = 0;
+
       virtual ~BlockLoader() = default;
     };
   }  // namespace network
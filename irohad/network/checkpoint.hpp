@@ -0,0 +1,42 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_CHECKPOINT_HPP
+#define IROHA_CHECKPOINT_HPP
+
+#include "ametsuchi/wsv_snapshot.hpp"
+#include "cryptography/hash.hpp"
+#include "cryptography/public_key.hpp"
+#include "cryptography/signed.hpp"
+
+namespace iroha {
+  namespace network {
+
+    /**
+     * Snapshot of the storage taken by a peer after the block with given
+     * hash. Peer signs the digest of the checkpoint, so a joining peer can
+     * trust the snapshot when the same digest is signed by supermajority
+     */
+    struct Checkpoint {
+      ametsuchi::WsvSnapshot snapshot;
+      shared_model::crypto::Hash block_hash;
+      shared_model::crypto::PublicKey signer;
+      shared_model::crypto::Signed signature;
+    };
+
+    /**
+     * Calculate digest which is signed by the creator of the checkpoint
+     * @param snapshot - state of the storage
+     * @param block_hash - hash of the block with snapshot height
+     * @return hash of the content of the checkpoint
+     */
+    shared_model::crypto::Hash checkpointDigest(
+        const ametsuchi::WsvSnapshot &snapshot,
+        const shared_model::crypto::Hash &block_hash);
+
+  }  // namespace network
+}  // namespace iroha
+
+#endif  // IROHA_CHECKPOINT_HPP
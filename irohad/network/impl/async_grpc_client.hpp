@@ -20,20 +20,26 @@
 
 #include <google/protobuf/empty.pb.h>
 #include <grpc++/grpc++.h>
+#include <functional>
 #include <thread>
 
+#include "network/impl/channel_pool.hpp"
+
 namespace iroha {
   namespace network {
 
     /**
-     * Asynchronous gRPC client which does no processing of server responses
+     * Asynchronous gRPC client which reports server responses to the channel
+     * pool and passes them to the handlers of the call, if any
      * @tparam Response type of server response
      */
     template <typename Response>
     class AsyncGrpcClient {
      public:
-      explicit AsyncGrpcClient(logger::Logger &&log)
-          : thread_(&AsyncGrpcClient::asyncCompleteRpc, this),
+      explicit AsyncGrpcClient(logger::Logger &&log,
+                               std::shared_ptr<ChannelPool> channels = nullptr)
+          : channels_(std::move(channels)),
+            thread_(&AsyncGrpcClient::asyncCompleteRpc, this),
             log_(std::move(log)) {}
 
       /**
@@ -46,6 +52,14 @@ namespace iroha {
           auto call = static_cast<AsyncClientCall *>(got_tag);
           if (not call->status.ok()) {
             log_->warn("RPC failed: {}", call->status.error_message());
+            if (call->on_failure) {
+              call->on_failure();
+            }
+          } else if (call->on_success) {
+            call->on_success(call->reply);
+          }
+          if (channels_ and not call->address.empty()) {
+            channels_->report(call->address, call->status);
           }
           delete call;
         }
@@ -58,6 +72,7 @@ namespace iroha {
         }
       }
 
+      std::shared_ptr<ChannelPool> channels_;
       grpc::CompletionQueue cq_;
       std::thread thread_;
       logger::Logger log_;
@@ -74,6 +89,16 @@ namespace iroha {
 
         std::unique_ptr<grpc::ClientAsyncResponseReader<Response>>
             response_reader;
+
+        /// address of the peer, used to report the result to the pool
+        std::string address;
+
+        /// invoked on the thread of the client if the call fails
+        std::function<void()> on_failure;
+
+        /// invoked on the thread of the client with the reply of successful
+        /// call
+        std::function<void(const Response &)> on_success;
       };
     };
   }  // namespace network
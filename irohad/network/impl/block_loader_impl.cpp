@@ -17,12 +17,19 @@
 
 #include "network/impl/block_loader_impl.hpp"
 
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <set>
+#include <thread>
+
 #include <grpc++/create_channel.h>
 
 #include "backend/protobuf/block.hpp"
 #include "builders/protobuf/transport_builder.hpp"
+#include "cryptography/crypto_provider/crypto_verifier.hpp"
 #include "interfaces/common_objects/peer.hpp"
-#include "network/impl/grpc_channel_builder.hpp"
 #include "validators/default_validator.hpp"
 
 using namespace iroha::ametsuchi;
@@ -32,8 +39,11 @@ using namespace shared_model::interface;
 namespace val = shared_model::validation;
 
 BlockLoaderImpl::BlockLoaderImpl(std::shared_ptr<PeerQuery> peer_query,
-                                 std::shared_ptr<BlockQuery> block_query)
-    : peer_query_(std::move(peer_query)), block_query_(std::move(block_query)) {
+                                 std::shared_ptr<BlockQuery> block_query,
+                                 std::shared_ptr<ChannelPool> channels)
+    : peer_query_(std::move(peer_query)),
+      block_query_(std::move(block_query)),
+      channels_(std::move(channels)) {
   log_ = logger::log("BlockLoaderImpl");
 }
 
@@ -89,8 +99,8 @@ rxcpp::observable<std::shared_ptr<Block>> BlockLoaderImpl::retrieveBlocks(
         // request next block to our top
         request.set_height(top_block->height() + 1);
 
-        auto reader =
-            this->getPeerStub(**peer).retrieveBlocks(&context, request);
+        auto stub = this->getPeerStub(**peer);
+        auto reader = stub->retrieveBlocks(&context, request);
         while (reader->Read(&block)) {
           shared_model::proto::TransportBuilder<shared_model::proto::Block,
                                                 Validator>(
@@ -116,6 +126,253 @@ rxcpp::observable<std::shared_ptr<Block>> BlockLoaderImpl::retrieveBlocks(
       });
 }
 
+namespace {
+  /**
+   * State of download shared by the threads of the peers and the threads
+   * which validate received blocks
+   */
+  struct Download {
+    using Range = std::pair<types::HeightType, types::HeightType>;
+
+    /// received block which is not validated yet
+    struct Received {
+      size_t peer;
+      iroha::protocol::Block block;
+    };
+
+    std::mutex mutex;
+    std::condition_variable cv;
+    /// ranges which are not downloaded yet, ordered by height
+    std::set<Range> ranges;
+    /// number of ranges which are being downloaded
+    size_t in_flight = 0;
+    /// blocks waiting for stateless validation
+    std::deque<Received> received;
+    /// number of blocks which are being validated
+    size_t validating = 0;
+    /// validated blocks which are not emitted yet, with indices of the peers
+    std::map<types::HeightType, std::pair<size_t, std::shared_ptr<Block>>>
+        blocks;
+    /// peers which sent a block which failed validation
+    std::vector<bool> failed;
+    /// height of the next block to be emitted
+    types::HeightType next;
+    /// number of peers which are still downloading
+    size_t workers;
+    /// set when no more blocks are expected
+    bool done = false;
+
+    /**
+     * @return true if nothing is left to download or validate
+     */
+    bool idle() const {
+      return ranges.empty() and in_flight == 0 and received.empty()
+          and validating == 0;
+    }
+  };
+}  // namespace
+
+constexpr types::HeightType BlockLoaderImpl::kBlocksPerRange;
+constexpr types::HeightType BlockLoaderImpl::kMaxBufferedBlocks;
+
+rxcpp::observable<LoadedBlock> BlockLoaderImpl::retrieveBlocks(
+    const std::vector<PublicKey> &peer_pubkeys, types::HeightType height) {
+  return rxcpp::observable<>::create<LoadedBlock>(
+      [this, peer_pubkeys, height](auto subscriber) {
+        auto top_height = block_query_->getTopBlockHeight();
+
+        std::vector<PublicKey> keys;
+        std::vector<std::unique_ptr<proto::Loader::Stub>> stubs;
+        for (const auto &pubkey : peer_pubkeys) {
+          if (auto peer = this->findPeer(pubkey)) {
+            keys.push_back(pubkey);
+            stubs.emplace_back(this->getPeerStub(**peer));
+          }
+        }
+        if (stubs.empty() or top_height >= height) {
+          subscriber.on_completed();
+          return;
+        }
+
+        Download download;
+        download.next = top_height + 1;
+        download.workers = stubs.size();
+        download.failed.resize(stubs.size(), false);
+        for (auto begin = download.next; begin <= height;
+             begin += kBlocksPerRange) {
+          download.ranges.emplace(
+              begin, std::min(begin + kBlocksPerRange - 1, height));
+        }
+
+        // peer threads only read the streams, so network is not idle while
+        // blocks are validated
+        auto read = [this, &download](size_t peer,
+                                      proto::Loader::Stub &stub) {
+          std::unique_lock<std::mutex> lock(download.mutex);
+          while (not download.failed[peer]) {
+            // range is taken when it is close enough to the emitted blocks,
+            // peer stops when nothing is left, including ranges which may be
+            // returned by validation, or when blocks are not needed anymore
+            download.cv.wait(lock, [&download, peer] {
+              return download.done or download.failed[peer] or download.idle()
+                  or (not download.ranges.empty()
+                      and download.ranges.begin()->first
+                          < download.next + kMaxBufferedBlocks);
+            });
+            if (download.done or download.failed[peer]
+                or download.ranges.empty()) {
+              break;
+            }
+            auto range = *download.ranges.begin();
+            download.ranges.erase(download.ranges.begin());
+            ++download.in_flight;
+
+            lock.unlock();
+            auto blocks = this->retrieveRange(stub, range.first, range.second);
+            lock.lock();
+
+            --download.in_flight;
+            if (not blocks) {
+              // range is left to other peers, failed peer is not used anymore
+              download.ranges.insert(range);
+              break;
+            }
+            for (auto &block : *blocks) {
+              download.received.push_back({peer, std::move(block)});
+            }
+            download.cv.notify_all();
+          }
+          --download.workers;
+          download.cv.notify_all();
+        };
+
+        // stateless validation and signature verification of received blocks
+        // run ahead of the subscriber, which applies blocks sequentially
+        auto validate = [this, &download] {
+          std::unique_lock<std::mutex> lock(download.mutex);
+          while (true) {
+            download.cv.wait(lock, [&download] {
+              return download.done or not download.received.empty();
+            });
+            if (download.done) {
+              break;
+            }
+            auto received = std::move(download.received.front());
+            download.received.pop_front();
+            ++download.validating;
+
+            lock.unlock();
+            auto height = received.block.payload().height();
+            auto block = this->validateBlock(std::move(received.block));
+            lock.lock();
+
+            --download.validating;
+            if (block) {
+              download.blocks.emplace(
+                  height, std::make_pair(received.peer, std::move(block)));
+            } else {
+              // peer which sent invalid block is not trusted anymore
+              download.failed[received.peer] = true;
+              download.ranges.emplace(height, height);
+            }
+            download.cv.notify_all();
+          }
+        };
+
+        std::vector<std::thread> threads;
+        for (size_t i = 0; i < stubs.size(); ++i) {
+          threads.emplace_back(read, i, std::ref(*stubs[i]));
+        }
+        auto validators = std::max(1u, std::thread::hardware_concurrency());
+        for (size_t i = 0; i < validators; ++i) {
+          threads.emplace_back(validate);
+        }
+
+        // subscriber which rejected a block stops the download
+        std::unique_lock<std::mutex> lock(download.mutex);
+        while (download.next <= height and subscriber.is_subscribed()) {
+          download.cv.wait(lock, [&download] {
+            return download.blocks.count(download.next) != 0
+                or (download.workers == 0 and download.received.empty()
+                    and download.validating == 0);
+          });
+          auto it = download.blocks.find(download.next);
+          if (it == download.blocks.end()) {
+            log_->error("Failed to retrieve block {} from any of {} peers",
+                        download.next,
+                        stubs.size());
+            break;
+          }
+          LoadedBlock loaded{keys[it->second.first],
+                             std::move(it->second.second)};
+          download.blocks.erase(it);
+          ++download.next;
+          download.cv.notify_all();
+
+          lock.unlock();
+          subscriber.on_next(std::move(loaded));
+          lock.lock();
+        }
+        download.done = true;
+        download.cv.notify_all();
+        lock.unlock();
+
+        for (auto &thread : threads) {
+          thread.join();
+        }
+        subscriber.on_completed();
+      });
+}
+
+boost::optional<BlockLoaderImpl::ProtoBlocks> BlockLoaderImpl::retrieveRange(
+    proto::Loader::Stub &stub,
+    types::HeightType begin,
+    types::HeightType end) {
+  proto::BlocksRequest request;
+  grpc::ClientContext context;
+  protocol::Block block;
+
+  request.set_height(begin);
+  request.set_count(end - begin + 1);
+
+  ProtoBlocks result;
+  auto expected = static_cast<size_t>(end - begin + 1);
+  auto reader = stub.retrieveBlocks(&context, request);
+  while (result.size() < expected and reader->Read(&block)) {
+    // peer must send blocks of the range one by one
+    if (block.payload().height() != begin + result.size()) {
+      break;
+    }
+    result.push_back(std::move(block));
+  }
+  // rest of the stream is not needed, so it is cancelled
+  context.TryCancel();
+  reader->Finish();
+
+  if (result.size() != expected) {
+    log_->warn("Failed to retrieve blocks [{}, {}]", begin, end);
+    return boost::none;
+  }
+  return result;
+}
+
+std::shared_ptr<Block> BlockLoaderImpl::validateBlock(protocol::Block block) {
+  std::shared_ptr<Block> result;
+  auto created_time = block.payload().created_time();
+  shared_model::proto::TransportBuilder<shared_model::proto::Block, Validator>(
+      Validator(TimerWrapper(created_time)))
+      .build(std::move(block))
+      .match(
+          [&result](iroha::expected::Value<shared_model::proto::Block> &value) {
+            result = std::make_shared<shared_model::proto::Block>(
+                std::move(value.value));
+          },
+          [this](iroha::expected::Error<std::string> &error) {
+            log_->error(error.error);
+          });
+  return result;
+}
+
 boost::optional<std::shared_ptr<Block>> BlockLoaderImpl::retrieveBlock(
     const PublicKey &peer_pubkey, const types::HashType &block_hash) {
   auto peer = findPeer(peer_pubkey);
@@ -131,7 +388,8 @@ boost::optional<std::shared_ptr<Block>> BlockLoaderImpl::retrieveBlock(
   // request block with specified hash
   request.set_hash(toBinaryString(block_hash));
 
-  auto status = getPeerStub(**peer).retrieveBlock(&context, request, &block);
+  auto status = getPeerStub(**peer)->retrieveBlock(&context, request, &block);
+  channels_->report((*peer)->address(), status);
   if (not status.ok()) {
     log_->warn(status.error_message());
     return boost::none;
@@ -149,6 +407,44 @@ boost::optional<std::shared_ptr<Block>> BlockLoaderImpl::retrieveBlock(
   return boost::optional<std::shared_ptr<Block>>(std::move(result));
 }
 
+boost::optional<Checkpoint> BlockLoaderImpl::retrieveCheckpoint(
+    const shared_model::interface::Peer &peer) {
+  proto::SnapshotRequest request;
+  grpc::ClientContext context;
+  proto::WsvSnapshot response;
+
+  auto status =
+      getPeerStub(peer)->retrieveSnapshot(&context, request, &response);
+  channels_->report(peer.address(), status);
+  if (not status.ok()) {
+    log_->warn(status.error_message());
+    return boost::none;
+  }
+
+  Checkpoint checkpoint{
+      {response.height(), {}},
+      shared_model::crypto::Hash(response.block_hash()),
+      PublicKey(response.signature().pubkey()),
+      Signed(response.signature().signature())};
+  for (auto &table : *response.mutable_tables()) {
+    checkpoint.snapshot.tables.push_back(
+        {std::move(*table.mutable_name()),
+         {std::make_move_iterator(table.mutable_rows()->begin()),
+          std::make_move_iterator(table.mutable_rows()->end())}});
+  }
+
+  // checkpoint is accepted only from the peer which created it
+  if (checkpoint.signer != peer.pubkey()
+      or not shared_model::crypto::CryptoVerifier<>::verify(
+             checkpoint.signature,
+             checkpointDigest(checkpoint.snapshot, checkpoint.block_hash),
+             checkpoint.signer)) {
+    log_->error("Checkpoint of {} has wrong signature", peer.pubkey().hex());
+    return boost::none;
+  }
+  return checkpoint;
+}
+
 boost::optional<std::shared_ptr<shared_model::interface::Peer>>
 BlockLoaderImpl::findPeer(const shared_model::crypto::PublicKey &pubkey) {
   auto peers = peer_query_->getLedgerPeers();
@@ -169,15 +465,7 @@ BlockLoaderImpl::findPeer(const shared_model::crypto::PublicKey &pubkey) {
   return *it;
 }
 
-proto::Loader::Stub &BlockLoaderImpl::getPeerStub(
+std::unique_ptr<proto::Loader::Stub> BlockLoaderImpl::getPeerStub(
     const shared_model::interface::Peer &peer) {
-  auto it = peer_connections_.find(peer.address());
-  if (it == peer_connections_.end()) {
-    it = peer_connections_
-             .insert(std::make_pair(
-                 peer.address(),
-                 network::createClient<proto::Loader>(peer.address())))
-             .first;
-  }
-  return *it->second;
+  return channels_->client<proto::Loader>(peer);
 }
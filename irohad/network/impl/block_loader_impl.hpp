@@ -20,12 +20,12 @@
 
 #include "network/block_loader.hpp"
 
-#include <unordered_map>
 
 #include "ametsuchi/block_query.hpp"
 #include "ametsuchi/peer_query.hpp"
 #include "loader.grpc.pb.h"
 #include "logger/logger.hpp"
+#include "network/impl/channel_pool.hpp"
 #include "validators/default_validator.hpp"
 
 namespace iroha {
@@ -33,18 +33,59 @@ namespace iroha {
     class BlockLoaderImpl : public BlockLoader {
      public:
       BlockLoaderImpl(std::shared_ptr<ametsuchi::PeerQuery> peer_query,
-                      std::shared_ptr<ametsuchi::BlockQuery> block_query);
+                      std::shared_ptr<ametsuchi::BlockQuery> block_query,
+                      std::shared_ptr<ChannelPool> channels);
 
       rxcpp::observable<std::shared_ptr<shared_model::interface::Block>>
       retrieveBlocks(
           const shared_model::crypto::PublicKey &peer_pubkey) override;
 
+      rxcpp::observable<LoadedBlock> retrieveBlocks(
+          const std::vector<shared_model::crypto::PublicKey> &peer_pubkeys,
+          shared_model::interface::types::HeightType height) override;
+
       boost::optional<std::shared_ptr<shared_model::interface::Block>>
       retrieveBlock(
           const shared_model::crypto::PublicKey &peer_pubkey,
           const shared_model::interface::types::HashType &block_hash) override;
 
+      boost::optional<Checkpoint> retrieveCheckpoint(
+          const shared_model::interface::Peer &peer) override;
+
      private:
+      /// number of blocks requested from a peer at once
+      static constexpr shared_model::interface::types::HeightType
+          kBlocksPerRange = 64;
+
+      /// maximum number of blocks downloaded ahead of the emitted ones
+      static constexpr shared_model::interface::types::HeightType
+          kMaxBufferedBlocks = 1024;
+
+      /// received blocks of a range in order of height
+      using ProtoBlocks = std::vector<protocol::Block>;
+
+      /**
+       * Download range of blocks from peer without validating them
+       * @param stub - RPC stub of the peer
+       * @param begin - height of the first block of the range
+       * @param end - height of the last block of the range
+       * @return blocks of the range, nullopt if peer failed to provide any
+       * of them
+       */
+      boost::optional<ProtoBlocks> retrieveRange(
+          proto::Loader::Stub &stub,
+          shared_model::interface::types::HeightType begin,
+          shared_model::interface::types::HeightType end);
+
+      /**
+       * Perform stateless validation of received block, including
+       * verification of its signatures
+       * @param block - received block
+       * @return valid block, nullptr otherwise
+       */
+      std::shared_ptr<shared_model::interface::Block> validateBlock(
+          protocol::Block block);
+
       /**
        * Retrieve peers from database, and find the requested peer by pubkey
        * @param pubkey - public key of requested peer
@@ -54,18 +95,16 @@ namespace iroha {
       boost::optional<std::shared_ptr<shared_model::interface::Peer>> findPeer(
           const shared_model::crypto::PublicKey &pubkey);
       /**
-       * Get or create a RPC stub for connecting to peer
+       * Create a RPC stub on the shared channel to peer
        * @param peer for connecting
        * @return RPC stub
        */
-      proto::Loader::Stub &getPeerStub(
+      std::unique_ptr<proto::Loader::Stub> getPeerStub(
           const shared_model::interface::Peer &peer);
 
-      std::unordered_map<shared_model::interface::types::AddressType,
-                         std::unique_ptr<proto::Loader::Stub>>
-          peer_connections_;
       std::shared_ptr<ametsuchi::PeerQuery> peer_query_;
       std::shared_ptr<ametsuchi::BlockQuery> block_query_;
+      std::shared_ptr<ChannelPool> channels_;
 
       logger::Logger log_;
     };
@@ -22,8 +22,10 @@ using namespace iroha;
 using namespace iroha::ametsuchi;
 using namespace iroha::network;
 
-BlockLoaderService::BlockLoaderService(std::shared_ptr<BlockQuery> storage)
-    : storage_(std::move(storage)) {
+BlockLoaderService::BlockLoaderService(
+    std::shared_ptr<BlockQuery> storage,
+    std::shared_ptr<CheckpointKeeper> checkpoints)
+    : storage_(std::move(storage)), checkpoints_(std::move(checkpoints)) {
   log_ = logger::log("BlockLoaderService");
 }
 
@@ -31,7 +33,9 @@ grpc::Status BlockLoaderService::retrieveBlocks(
     ::grpc::ServerContext *context,
     const proto::BlocksRequest *request,
     ::grpc::ServerWriter<::iroha::protocol::Block> *writer) {
-  auto blocks = storage_->getBlocksFrom(request->height());
+  auto blocks = request->count() == 0
+      ? storage_->getBlocksFrom(request->height())
+      : storage_->getBlocks(request->height(), request->count());
   std::for_each(blocks.begin(), blocks.end(), [&writer](const auto &block) {
     writer->Write(std::dynamic_pointer_cast<shared_model::proto::Block>(block)
                       ->getTransport());
@@ -66,3 +70,31 @@ grpc::Status BlockLoaderService::retrieveBlock(
   response->CopyFrom(result.value());
   return grpc::Status::OK;
 }
+
+grpc::Status BlockLoaderService::retrieveSnapshot(
+    ::grpc::ServerContext *context,
+    const proto::SnapshotRequest *request,
+    proto::WsvSnapshot *response) {
+  auto checkpoint = checkpoints_ ? checkpoints_->latest() : nullptr;
+  if (not checkpoint) {
+    log_->info("No checkpoint is created yet");
+    return grpc::Status(grpc::StatusCode::NOT_FOUND, "Snapshot not found");
+  }
+
+  response->set_height(checkpoint->snapshot.height);
+  response->set_block_hash(
+      shared_model::crypto::toBinaryString(checkpoint->block_hash));
+  for (const auto &table : checkpoint->snapshot.tables) {
+    auto proto_table = response->add_tables();
+    proto_table->set_name(table.name);
+    for (const auto &row : table.rows) {
+      proto_table->add_rows(row);
+    }
+  }
+  auto signature = response->mutable_signature();
+  signature->set_pubkey(
+      shared_model::crypto::toBinaryString(checkpoint->signer));
+  signature->set_signature(
+      shared_model::crypto::toBinaryString(checkpoint->signature));
+  return grpc::Status::OK;
+}
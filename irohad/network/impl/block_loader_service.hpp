@@ -21,13 +21,20 @@
 #include "ametsuchi/block_query.hpp"
 #include "loader.grpc.pb.h"
 #include "logger/logger.hpp"
+#include "network/impl/checkpoint_keeper.hpp"
 
 namespace iroha {
   namespace network {
     class BlockLoaderService : public proto::Loader::Service {
      public:
+      /**
+       * @param storage - storage to retrieve blocks from
+       * @param checkpoints - source of snapshots for joining peers, snapshots
+       * are not served if it is not set
+       */
       explicit BlockLoaderService(
-          std::shared_ptr<ametsuchi::BlockQuery> storage);
+          std::shared_ptr<ametsuchi::BlockQuery> storage,
+          std::shared_ptr<CheckpointKeeper> checkpoints = nullptr);
 
       grpc::Status retrieveBlocks(
           ::grpc::ServerContext *context,
@@ -38,8 +45,13 @@ namespace iroha {
                                  const proto::BlockRequest *request,
                                  protocol::Block *response) override;
 
+      grpc::Status retrieveSnapshot(::grpc::ServerContext *context,
+                                    const proto::SnapshotRequest *request,
+                                    proto::WsvSnapshot *response) override;
+
      private:
       std::shared_ptr<ametsuchi::BlockQuery> storage_;
+      std::shared_ptr<CheckpointKeeper> checkpoints_;
       logger::Logger log_;
     };
   }  // namespace network
@@ -0,0 +1,108 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "network/impl/channel_pool.hpp"
+
+#include "interfaces/common_objects/peer.hpp"
+#include "network/impl/grpc_channel_builder.hpp"
+
+namespace iroha {
+  namespace network {
+
+    constexpr std::chrono::minutes ChannelPool::kDefaultIdleTimeout;
+    constexpr size_t ChannelPool::kMaxFailures;
+
+    ChannelPool::ChannelPool(Clock::duration idle_timeout)
+        : idle_timeout_(idle_timeout),
+          last_eviction_(Clock::now()),
+          log_(logger::log("ChannelPool")) {}
+
+    std::shared_ptr<grpc::Channel> ChannelPool::channel(
+        const std::string &address) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      return get(address);
+    }
+
+    std::shared_ptr<grpc::Channel> ChannelPool::channel(
+        const shared_model::interface::Peer &peer) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto &address = addresses_[peer.pubkey().hex()];
+      if (not address.empty() and address != peer.address()) {
+        log_->info("Address of peer changed from {} to {}",
+                   address,
+                   peer.address());
+        channels_.erase(address);
+      }
+      address = peer.address();
+      return get(address);
+    }
+
+    void ChannelPool::report(const std::string &address,
+                             const grpc::Status &status) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto it = channels_.find(address);
+      if (it == channels_.end()) {
+        return;
+      }
+      // other errors are returned by the peer, so the connection is alive
+      if (status.error_code() == grpc::StatusCode::UNAVAILABLE
+          or status.error_code() == grpc::StatusCode::DEADLINE_EXCEEDED) {
+        ++it->second.failures;
+      } else {
+        it->second.failures = 0;
+      }
+    }
+
+    void ChannelPool::invalidate(const std::string &address) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      channels_.erase(address);
+    }
+
+    size_t ChannelPool::size() const {
+      std::lock_guard<std::mutex> lock(mutex_);
+      return channels_.size();
+    }
+
+    std::shared_ptr<grpc::Channel> ChannelPool::get(
+        const std::string &address) {
+      auto now = Clock::now();
+      evictIdle(now);
+
+      auto &entry = channels_[address];
+      if (entry.channel
+          and (entry.failures >= kMaxFailures
+               or entry.channel->GetState(false) == GRPC_CHANNEL_SHUTDOWN)) {
+        // clients which still hold the old channel keep it until they are
+        // destroyed, new clients get a fresh connection
+        log_->warn("Channel to {} is unhealthy, reconnecting", address);
+        entry.channel.reset();
+      }
+      if (not entry.channel) {
+        entry.channel = createChannel(address);
+        entry.failures = 0;
+      }
+      entry.last_used = now;
+      return entry.channel;
+    }
+
+    void ChannelPool::evictIdle(Clock::time_point now) {
+      if (now - last_eviction_ < idle_timeout_) {
+        return;
+      }
+      last_eviction_ = now;
+      for (auto it = channels_.begin(); it != channels_.end();) {
+        // channel held by a client, e.g. by a long-lived stream, is kept, so
+        // that next request does not open second connection to the peer
+        if (now - it->second.last_used >= idle_timeout_
+            and it->second.channel.use_count() == 1) {
+          it = channels_.erase(it);
+        } else {
+          ++it;
+        }
+      }
+    }
+
+  }  // namespace network
+}  // namespace iroha
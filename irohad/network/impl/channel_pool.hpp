@@ -0,0 +1,138 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_CHANNEL_POOL_HPP
+#define IROHA_CHANNEL_POOL_HPP
+
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include <grpc++/grpc++.h>
+
+#include "logger/logger.hpp"
+
+namespace shared_model {
+  namespace interface {
+    class Peer;
+  }  // namespace interface
+}  // namespace shared_model
+
+namespace iroha {
+  namespace network {
+
+    /**
+     * Registry of gRPC channels to peers shared by all outbound transports.
+     * One channel is kept per address, so all clients of a peer share one
+     * HTTP/2 connection. Channel is recreated after several connection
+     * failures in a row, channels which are not requested for a while and
+     * are not used by any client are dropped
+     */
+    class ChannelPool {
+     public:
+      using Clock = std::chrono::steady_clock;
+
+      /// time after which unused channel is dropped
+      static constexpr std::chrono::minutes kDefaultIdleTimeout{5};
+
+      /// number of failed calls in a row after which channel is recreated
+      static constexpr size_t kMaxFailures = 3;
+
+      /**
+       * @param idle_timeout - time after which unused channel is dropped
+       */
+      explicit ChannelPool(Clock::duration idle_timeout = kDefaultIdleTimeout);
+
+      /**
+       * Get channel to given address, channel is created if required
+       * @param address - address of the peer, ipv4:port
+       * @return channel to the address
+       */
+      std::shared_ptr<grpc::Channel> channel(const std::string &address);
+
+      /**
+       * Get channel to given peer. If address of the peer has changed since
+       * the previous request, channel to the old address is dropped
+       * @param peer - peer to connect to
+       * @return channel to the address of the peer
+       */
+      std::shared_ptr<grpc::Channel> channel(
+          const shared_model::interface::Peer &peer);
+
+      /**
+       * Create client of given service on the shared channel
+       * @tparam T type for gRPC service, e.g. proto::Yac
+       * @param address - address of the peer, ipv4:port
+       * @return gRPC stub of parametrized type
+       */
+      template <typename T>
+      auto client(const std::string &address) {
+        return T::NewStub(channel(address));
+      }
+
+      /**
+       * Create client of given service on the shared channel
+       * @tparam T type for gRPC service, e.g. proto::Yac
+       * @param peer - peer to connect to
+       * @return gRPC stub of parametrized type
+       */
+      template <typename T>
+      auto client(const shared_model::interface::Peer &peer) {
+        return T::NewStub(channel(peer));
+      }
+
+      /**
+       * Record result of a call made through the channel to given address
+       * @param address - address the call was made to
+       * @param status - result of the call
+       */
+      void report(const std::string &address, const grpc::Status &status);
+
+      /**
+       * Drop channel to given address, next request creates a new one
+       * @param address - address of the channel
+       */
+      void invalidate(const std::string &address);
+
+      /**
+       * @return number of channels in the pool
+       */
+      size_t size() const;
+
+     private:
+      struct Entry {
+        std::shared_ptr<grpc::Channel> channel;
+        Clock::time_point last_used;
+        size_t failures;
+      };
+
+      /**
+       * Get or create channel, mutex_ should be locked
+       */
+      std::shared_ptr<grpc::Channel> get(const std::string &address);
+
+      /**
+       * Drop idle channels if idle timeout has passed since previous check,
+       * mutex_ should be locked
+       */
+      void evictIdle(Clock::time_point now);
+
+      const Clock::duration idle_timeout_;
+
+      mutable std::mutex mutex_;
+      std::unordered_map<std::string, Entry> channels_;
+      // last requested address of each peer by hex of its public key
+      std::unordered_map<std::string, std::string> addresses_;
+      Clock::time_point last_eviction_;
+
+      logger::Logger log_;
+    };
+
+  }  // namespace network
+}  // namespace iroha
+
+#endif  // IROHA_CHANNEL_POOL_HPP
@@ -0,0 +1,39 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "network/checkpoint.hpp"
+
+#include "cryptography/default_hash_provider.hpp"
+
+namespace iroha {
+  namespace network {
+
+    shared_model::crypto::Hash checkpointDigest(
+        const ametsuchi::WsvSnapshot &snapshot,
+        const shared_model::crypto::Hash &block_hash) {
+      // every field is prefixed with its size, so different snapshots
+      // cannot have the same encoding
+      std::string data;
+      auto append = [&data](const std::string &field) {
+        data += std::to_string(field.size());
+        data += ':';
+        data += field;
+      };
+
+      append(std::to_string(snapshot.height));
+      append(block_hash.hex());
+      for (const auto &table : snapshot.tables) {
+        append(table.name);
+        append(std::to_string(table.rows.size()));
+        for (const auto &row : table.rows) {
+          append(row);
+        }
+      }
+      return shared_model::crypto::DefaultHashProvider::makeHash(
+          shared_model::crypto::Blob(data));
+    }
+
+  }  // namespace network
+}  // namespace iroha
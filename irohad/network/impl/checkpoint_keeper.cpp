@@ -0,0 +1,77 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "network/impl/checkpoint_keeper.hpp"
+
+#include "cryptography/crypto_provider/crypto_defaults.hpp"
+#include "interfaces/iroha_internal/block.hpp"
+
+namespace iroha {
+  namespace network {
+
+    constexpr shared_model::interface::types::HeightType
+        CheckpointKeeper::kDefaultInterval;
+
+    CheckpointKeeper::CheckpointKeeper(
+        std::shared_ptr<ametsuchi::Storage> storage,
+        shared_model::crypto::Keypair keypair,
+        shared_model::interface::types::HeightType interval)
+        : storage_(std::move(storage)),
+          keypair_(std::move(keypair)),
+          log_(logger::log("CheckpointKeeper")) {
+      // snapshot reads whole storage, so it is taken off the commit thread
+      subscription_ =
+          storage_->on_commit()
+              .filter([interval](const auto &block) {
+                return block->height() % interval == 0;
+              })
+              .observe_on(rxcpp::observe_on_new_thread())
+              .subscribe([this](const auto &block) {
+                this->update(block->height(), block->hash());
+              });
+    }
+
+    CheckpointKeeper::~CheckpointKeeper() {
+      subscription_.unsubscribe();
+    }
+
+    std::shared_ptr<const Checkpoint> CheckpointKeeper::latest() const {
+      std::lock_guard<std::mutex> lock(mutex_);
+      return checkpoint_;
+    }
+
+    void CheckpointKeeper::update(
+        shared_model::interface::types::HeightType height,
+        const shared_model::crypto::Hash &block_hash) {
+      auto snapshot = storage_->createSnapshot();
+      if (not snapshot) {
+        return;
+      }
+      // snapshot with next blocks applied would differ from ones of other
+      // peers, so it is not useful for joining peers
+      if (snapshot->height != height) {
+        log_->info("Checkpoint at {} is skipped, storage is already at {}",
+                   height,
+                   snapshot->height);
+        return;
+      }
+
+      auto digest = checkpointDigest(*snapshot, block_hash);
+      auto signature =
+          shared_model::crypto::DefaultCryptoAlgorithmType::sign(digest,
+                                                                 keypair_);
+      auto checkpoint = std::make_shared<const Checkpoint>(
+          Checkpoint{std::move(*snapshot),
+                     block_hash,
+                     keypair_.publicKey(),
+                     std::move(signature)});
+
+      std::lock_guard<std::mutex> lock(mutex_);
+      checkpoint_ = std::move(checkpoint);
+      log_->info("Checkpoint at {} is created", height);
+    }
+
+  }  // namespace network
+}  // namespace iroha
@@ -0,0 +1,73 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_CHECKPOINT_KEEPER_HPP
+#define IROHA_CHECKPOINT_KEEPER_HPP
+
+#include <memory>
+#include <mutex>
+
+#include <rxcpp/rx.hpp>
+
+#include "ametsuchi/storage.hpp"
+#include "cryptography/keypair.hpp"
+#include "logger/logger.hpp"
+#include "network/checkpoint.hpp"
+
+namespace iroha {
+  namespace network {
+
+    /**
+     * Creates signed checkpoints of the storage after every block with height
+     * divisible by the interval and keeps the latest one for joining peers.
+     * All honest peers produce equal snapshots at the same height, so their
+     * signatures can be counted by a joining peer
+     */
+    class CheckpointKeeper {
+     public:
+      /// default number of blocks between checkpoints
+      static constexpr shared_model::interface::types::HeightType
+          kDefaultInterval = 1000;
+
+      /**
+       * @param storage - storage to take snapshots of
+       * @param keypair - keypair of the peer to sign checkpoints
+       * @param interval - number of blocks between checkpoints
+       */
+      CheckpointKeeper(std::shared_ptr<ametsuchi::Storage> storage,
+                       shared_model::crypto::Keypair keypair,
+                       shared_model::interface::types::HeightType interval =
+                           kDefaultInterval);
+
+      ~CheckpointKeeper();
+
+      /**
+       * @return latest checkpoint, nullptr if none was created yet
+       */
+      std::shared_ptr<const Checkpoint> latest() const;
+
+     private:
+      /**
+       * Take snapshot of the storage and sign it
+       * @param height - height of committed block
+       * @param block_hash - hash of committed block
+       */
+      void update(shared_model::interface::types::HeightType height,
+                  const shared_model::crypto::Hash &block_hash);
+
+      std::shared_ptr<ametsuchi::Storage> storage_;
+      shared_model::crypto::Keypair keypair_;
+
+      mutable std::mutex mutex_;
+      std::shared_ptr<const Checkpoint> checkpoint_;
+
+      rxcpp::composite_subscription subscription_;
+      logger::Logger log_;
+    };
+
+  }  // namespace network
+}  // namespace iroha
+
+#endif  // IROHA_CHECKPOINT_KEEPER_HPP
@@ -24,22 +24,32 @@ namespace iroha {
   namespace network {
 
     /**
-     * Creates client which is capable of sending and receiving
+     * Creates channel which is capable of sending and receiving
      * messages of INT_MAX bytes size
-     * @tparam T type for gRPC stub, e.g. proto::Yac
      * @param address ip address for connection, ipv4:port
-     * @return gRPC stub of parametrized type
+     * @return gRPC channel
      */
-    template <typename T>
-    auto createClient(const grpc::string& address) {
+    inline std::shared_ptr<grpc::Channel> createChannel(
+        const grpc::string& address) {
       // in order to bypass built-in limitation of gRPC message size
       grpc::ChannelArguments args;
       args.SetMaxSendMessageSize(INT_MAX);
       args.SetMaxReceiveMessageSize(INT_MAX);
 
-      return
-          T::NewStub(grpc::CreateCustomChannel(
-              address, grpc::InsecureChannelCredentials(), args));
+      return grpc::CreateCustomChannel(
+          address, grpc::InsecureChannelCredentials(), args);
+    }
+
+    /**
+     * Creates client on a new channel which is capable of sending and
+     * receiving messages of INT_MAX bytes size
+     * @tparam T type for gRPC stub, e.g. proto::Yac
+     * @param address ip address for connection, ipv4:port
+     * @return gRPC stub of parametrized type
+     */
+    template <typename T>
+    auto createClient(const grpc::string& address) {
+      return T::NewStub(createChannel(address));
     }
   } // namespace network
 } // namespace iroha
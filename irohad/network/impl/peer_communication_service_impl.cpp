@@ -60,5 +60,10 @@ namespace iroha {
     rxcpp::observable<Commit> PeerCommunicationServiceImpl::on_commit() const {
       return synchronizer_->on_commit_chain();
     }
+
+    rxcpp::observable<OrderingRejection>
+    PeerCommunicationServiceImpl::on_rejection() const {
+      return ordering_gate_->on_rejection();
+    }
   }  // namespace network
 }  // namespace iroha
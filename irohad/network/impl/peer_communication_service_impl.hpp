@@ -51,6 +51,8 @@ namespace iroha {
 
       rxcpp::observable<Commit> on_commit() const override;
 
+      rxcpp::observable<OrderingRejection> on_rejection() const override;
+
      private:
       std::shared_ptr<OrderingGate> ordering_gate_;
       std::shared_ptr<synchronizer::Synchronizer> synchronizer_;
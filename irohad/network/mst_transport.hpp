@@ -39,6 +39,20 @@ namespace iroha {
           const std::shared_ptr<shared_model::interface::Peer> &from,
           const MstState &new_state) = 0;
 
+      /**
+       * Handler method for summary of state of peer
+       * @param summary - hashes and signature fingerprints of transactions
+       * which the peer is going to send
+       * @return hashes of transactions which should be sent
+       */
+      virtual TransactionHashes onSummary(const MstSummary &summary) = 0;
+
+      /**
+       * Handler method for state which was not delivered to peer
+       * @param to - peer recipient of the state
+       */
+      virtual void onSendFailed(const shared_model::interface::Peer &to) {}
+
       virtual ~MstTransportNotification() = default;
     };
 
@@ -56,7 +70,8 @@ namespace iroha {
           std::shared_ptr<MstTransportNotification> notification) = 0;
 
       /**
-       * Share state with other peer
+       * Share state with other peer. Transport may describe the state to the
+       * peer first and send only transactions which the peer requests
        * @param to - peer recipient of message
        * @param providing_state - state for transmitting
        */
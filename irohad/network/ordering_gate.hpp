@@ -21,6 +21,7 @@
 #include <rxcpp/rx-observable.hpp>
 
 #include "interfaces/iroha_internal/transaction_batch.hpp"
+#include "network/ordering_rejection.hpp"
 #include "network/peer_communication_service.hpp"
 
 namespace shared_model {
@@ -61,6 +62,12 @@ namespace iroha {
           std::shared_ptr<shared_model::interface::Proposal>>
       on_proposal() = 0;
 
+      /**
+       * Return observable of transactions rejected by ordering service
+       * @return observable with rejected transactions
+       */
+      virtual rxcpp::observable<OrderingRejection> on_rejection() = 0;
+
       /**
        * Set peer communication service for commit notification
        * @param pcs - const reference for PeerCommunicationService
@@ -19,6 +19,8 @@
 
 #include <memory>
 
+#include "network/ordering_rejection.hpp"
+
 namespace shared_model {
   namespace interface {
     class Transaction;
@@ -43,6 +45,12 @@ namespace iroha {
       virtual void onProposal(
           std::shared_ptr<shared_model::interface::Proposal>) = 0;
 
+      /**
+       * Callback on transactions rejected by ordering service
+       * @param rejection - hashes of the transactions and load of the service
+       */
+      virtual void onRejection(OrderingRejection rejection) {}
+
       virtual ~OrderingGateNotification() = default;
     };
 
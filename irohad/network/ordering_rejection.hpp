@@ -0,0 +1,31 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_ORDERING_REJECTION_HPP
+#define IROHA_ORDERING_REJECTION_HPP
+
+#include <vector>
+
+#include "cryptography/hash.hpp"
+
+namespace iroha {
+  namespace network {
+
+    /**
+     * Transactions which ordering service has not accepted to its queue or
+     * has dropped from it because of overload
+     */
+    struct OrderingRejection {
+      std::vector<shared_model::crypto::Hash> hashes;
+
+      /// number of transactions in the queue of ordering service, so that
+      /// clients can estimate the load
+      size_t queue_size;
+    };
+
+  }  // namespace network
+}  // namespace iroha
+
+#endif  // IROHA_ORDERING_REJECTION_HPP
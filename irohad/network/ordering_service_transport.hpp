@@ -18,12 +18,29 @@
 #define IROHA_ORDERING_SERVICE_TRANSPORT_H
 
 #include <memory>
+#include <vector>
+
+#include "cryptography/hash.hpp"
 #include "interfaces/iroha_internal/proposal.hpp"
 #include "interfaces/iroha_internal/transaction_batch.hpp"
+#include "network/ordering_rejection.hpp"
 
 namespace iroha {
   namespace network {
 
+    /**
+     * Result of admission of batches into the queue of ordering service
+     */
+    struct Admission {
+      /// hashes of the transactions which were not admitted to the queue,
+      /// transactions dropped from the queue to make room for the admitted
+      /// ones are published to all peers
+      std::vector<shared_model::crypto::Hash> rejected;
+
+      /// number of transactions in the queue after admission
+      size_t queue_size = 0;
+    };
+
     /**
      * OrderingServiceNotification is a base class for any ordering service
      * implementation that want to be notified about incoming proposals
@@ -37,6 +54,19 @@ namespace iroha {
       virtual void onBatch(
           shared_model::interface::TransactionBatch &&batch) = 0;
 
+      /**
+       * Callback on receiving several batches at once
+       * @param batches - received batches in order of receiving
+       * @return transactions which are not in the queue and its size
+       */
+      virtual Admission onBatches(
+          std::vector<shared_model::interface::TransactionBatch> batches) {
+        for (auto &batch : batches) {
+          onBatch(std::move(batch));
+        }
+        return {};
+      }
+
       virtual ~OrderingServiceNotification() = default;
     };
 
@@ -63,6 +93,14 @@ namespace iroha {
           std::unique_ptr<shared_model::interface::Proposal> proposal,
           const std::vector<std::string> &peers) = 0;
 
+      /**
+       * Notify peers about transactions dropped from the queue
+       * @param dropped - hashes of the transactions and size of the queue
+       * @param peers - addresses of the peers
+       */
+      virtual void publishDropped(const OrderingRejection &dropped,
+                                  const std::vector<std::string> &peers) = 0;
+
       virtual ~OrderingServiceTransport() = default;
     };
 
@@ -20,6 +20,7 @@
 
 #include <rxcpp/rx.hpp>
 
+#include "network/ordering_rejection.hpp"
 #include "validation/stateful_validator_common.hpp"
 
 namespace shared_model {
@@ -84,6 +85,13 @@ namespace iroha {
        */
       virtual rxcpp::observable<Commit> on_commit() const = 0;
 
+      /**
+       * Event is triggered when ordering service does not accept transactions
+       * because of overload
+       * @return observable with rejected transactions
+       */
+      virtual rxcpp::observable<OrderingRejection> on_rejection() const = 0;
+
       virtual ~PeerCommunicationService() = default;
     };
   }  // namespace network
@@ -23,6 +23,7 @@
 #include "interfaces/iroha_internal/block.hpp"
 #include "interfaces/iroha_internal/proposal.hpp"
 #include "interfaces/transaction.hpp"
+#include "metrics/round_metrics.hpp"
 
 namespace iroha {
   namespace ordering {
@@ -68,6 +69,11 @@ namespace iroha {
       return proposals_.get_observable();
     }
 
+    rxcpp::observable<network::OrderingRejection>
+    OrderingGateImpl::on_rejection() {
+      return rejections_.get_observable();
+    }
+
     void OrderingGateImpl::setPcs(
         const iroha::network::PeerCommunicationService &pcs) {
       log_->info("setPcs");
@@ -107,9 +113,21 @@ namespace iroha {
       net_proposals_.get_subscriber().on_next(0);
     }
 
+    void OrderingGateImpl::onRejection(network::OrderingRejection rejection) {
+      log_->warn("Ordering service rejected {} transactions, queue size {}",
+                 rejection.hashes.size(),
+                 rejection.queue_size);
+      std::lock_guard<std::mutex> lock(rejection_mutex_);
+      rejections_.get_subscriber().on_next(std::move(rejection));
+    }
+
     void OrderingGateImpl::tryNextRound(
         shared_model::interface::types::HeightType last_block_height) {
       log_->debug("TryNextRound");
+      if (last_block_height != round_height_) {
+        round_height_ = last_block_height;
+        round_started_ = std::chrono::steady_clock::now();
+      }
       std::shared_ptr<shared_model::interface::Proposal> next_proposal;
       while (proposal_queue_.try_pop(next_proposal)) {
         // check for old proposal
@@ -125,6 +143,11 @@ namespace iroha {
         }
         log_->info("Pass the proposal to pipeline height {}",
                    next_proposal->height());
+        metrics::roundMetrics().record(
+            metrics::Phase::kOrdering,
+            next_proposal->height(),
+            std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now() - round_started_));
         proposals_.get_subscriber().on_next(next_proposal);
       }
     }
@@ -20,6 +20,7 @@
 
 #include "network/ordering_gate.hpp"
 
+#include <chrono>
 #include <mutex>
 
 #include <tbb/concurrent_priority_queue.h>
@@ -79,11 +80,15 @@ namespace iroha {
       rxcpp::observable<std::shared_ptr<shared_model::interface::Proposal>>
       on_proposal() override;
 
+      rxcpp::observable<network::OrderingRejection> on_rejection() override;
+
       void setPcs(const iroha::network::PeerCommunicationService &pcs) override;
 
       void onProposal(
           std::shared_ptr<shared_model::interface::Proposal> proposal) override;
 
+      void onRejection(network::OrderingRejection rejection) override;
+
       ~OrderingGateImpl() override;
 
      private:
@@ -107,6 +112,9 @@ namespace iroha {
 
       std::mutex proposal_mutex_;
 
+      rxcpp::subjects::subject<network::OrderingRejection> rejections_;
+      std::mutex rejection_mutex_;
+
       /// queue with all proposals received from ordering service
       tbb::concurrent_priority_queue<
           std::shared_ptr<shared_model::interface::Proposal>,
@@ -116,6 +124,11 @@ namespace iroha {
       /// last commited block height
       shared_model::interface::types::HeightType last_block_height_;
 
+      /// last block height of current round and time when it became known,
+      /// used to measure waiting for proposal
+      shared_model::interface::types::HeightType round_height_ = 0;
+      std::chrono::steady_clock::time_point round_started_;
+
       /// subscription of pcs::on_commit
       rxcpp::composite_subscription pcs_subscriber_;
 
@@ -16,21 +16,127 @@
  */
 #include "ordering_gate_transport_grpc.hpp"
 
+#include <set>
+
 #include "backend/protobuf/transaction.hpp"
 #include "builders/protobuf/proposal.hpp"
 #include "endpoint.pb.h"
 #include "interfaces/common_objects/types.hpp"
-#include "network/impl/grpc_channel_builder.hpp"
 
 using namespace iroha::ordering;
 
+constexpr size_t OrderingGateTransportGrpc::kMaxFrameTransactions;
+constexpr std::chrono::milliseconds OrderingGateTransportGrpc::kFlushDelay;
+
 grpc::Status OrderingGateTransportGrpc::onProposal(
     ::grpc::ServerContext *context,
     const iroha::protocol::Proposal *request,
     ::google::protobuf::Empty *response) {
   log_->info("receive proposal");
+  if (relay_.accept(*request)) {
+    handleProposal(*request);
+  }
+  return grpc::Status::OK;
+}
+
+grpc::Status OrderingGateTransportGrpc::onRelayedProposal(
+    ::grpc::ServerContext *context,
+    const proto::RelayedProposal *request,
+    ::google::protobuf::Empty *response) {
+  log_->info("receive relayed proposal");
+  if (not relay_.accept(request->proposal())) {
+    log_->info("proposal {} is already received",
+               request->proposal().height());
+    return grpc::Status::OK;
+  }
+  // sender waits for the reply with a deadline, so the proposal is forwarded
+  // and validated after the reply
+  {
+    std::lock_guard<std::mutex> lock(relayed_mutex_);
+    relayed_.push_back(*request);
+  }
+  relayed_cv_.notify_one();
+  return grpc::Status::OK;
+}
+
+grpc::Status OrderingGateTransportGrpc::onDroppedTransactions(
+    ::grpc::ServerContext *context,
+    const proto::DroppedTransactions *request,
+    ::google::protobuf::Empty *response) {
+  log_->info("receive {} dropped transactions", request->hashes_size());
+  auto subscriber = subscriber_.lock();
+  if (not subscriber) {
+    return grpc::Status::OK;
+  }
+  network::OrderingRejection rejection;
+  for (const auto &hash : request->hashes()) {
+    rejection.hashes.emplace_back(hash);
+  }
+  rejection.queue_size = request->queue_size();
+  subscriber->onRejection(std::move(rejection));
+  return grpc::Status::OK;
+}
+
+bool OrderingGateTransportGrpc::isSubtreeValid(
+    const proto::RelayedProposal &request) {
+  if (request.peers().empty()) {
+    return true;
+  }
+  if (not peer_query_) {
+    return false;
+  }
+  auto peers = peer_query_->getLedgerPeers();
+  if (not peers) {
+    log_->error("Failed to retrieve ledger peers");
+    return false;
+  }
+  std::set<std::string> addresses;
+  for (const auto &peer : *peers) {
+    addresses.insert(peer->address());
+  }
+  if (request.fanout() == 0 or request.fanout() > addresses.size()) {
+    return false;
+  }
+  // every peer of the subtree is a ledger peer, listed once
+  std::set<std::string> subtree;
+  for (const auto &peer : request.peers()) {
+    if (addresses.count(peer) == 0 or not subtree.insert(peer).second) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void OrderingGateTransportGrpc::processRelayed() {
+  std::unique_lock<std::mutex> lock(relayed_mutex_);
+  while (true) {
+    relayed_cv_.wait(lock,
+                     [this] { return stop_relayed_ or not relayed_.empty(); });
+    if (stop_relayed_) {
+      break;
+    }
+    auto request = std::move(relayed_.front());
+    relayed_.pop_front();
+    lock.unlock();
 
-  auto proposal_res = factory_->createProposal(*request);
+    // proposal is forwarded before it is validated in order not to delay the
+    // subtree, peers validate it themselves
+    if (isSubtreeValid(request)) {
+      relay_.relay(request.proposal(),
+                   {request.peers().begin(), request.peers().end()},
+                   request.fanout());
+    } else {
+      log_->error("Relayed proposal {} has invalid subtree, not forwarded",
+                  request.proposal().height());
+    }
+    handleProposal(request.proposal());
+    lock.lock();
+  }
+}
+
+void OrderingGateTransportGrpc::handleProposal(
+    const iroha::protocol::Proposal &request) {
+  auto proposal_res = factory_->createProposal(request);
   proposal_res.match(
       [this](iroha::expected::Value<
              std::unique_ptr<shared_model::interface::Proposal>> &v) {
@@ -46,47 +152,124 @@ grpc::Status OrderingGateTransportGrpc::onProposal(
       [this](const iroha::expected::Error<std::string> &e) {
         log_->error("Received invalid proposal: {}", e.error);
       });
-
-  return grpc::Status::OK;
 }
 
 OrderingGateTransportGrpc::OrderingGateTransportGrpc(
-    const std::string &server_address)
-    : network::AsyncGrpcClient<google::protobuf::Empty>(
-          logger::log("OrderingGate")),
-      client_(network::createClient<proto::OrderingServiceTransportGrpc>(
-          server_address)),
+    const std::string &server_address,
+    std::shared_ptr<network::ChannelPool> channels,
+    std::shared_ptr<ametsuchi::PeerQuery> peer_query)
+    : network::AsyncGrpcClient<proto::BatchesResponse>(
+          logger::log("OrderingGate"), std::move(channels)),
+      server_address_(server_address),
+      peer_query_(std::move(peer_query)),
+      relay_(channels_),
       factory_(std::make_unique<shared_model::proto::ProtoProposalFactory<
-                   shared_model::validation::DefaultProposalValidator>>()) {}
+                   shared_model::validation::DefaultProposalValidator>>()),
+      flush_thread_(&OrderingGateTransportGrpc::run, this),
+      relayed_thread_(&OrderingGateTransportGrpc::processRelayed, this) {}
+
+OrderingGateTransportGrpc::~OrderingGateTransportGrpc() {
+  {
+    std::lock_guard<std::mutex> lock(pending_mutex_);
+    stop_ = true;
+  }
+  pending_cv_.notify_one();
+  flush_thread_.join();
+
+  {
+    std::lock_guard<std::mutex> lock(relayed_mutex_);
+    stop_relayed_ = true;
+  }
+  relayed_cv_.notify_one();
+  relayed_thread_.join();
+
+  // responses are handled on the thread of the queue with the subscriber, so
+  // it is stopped before the members are destroyed
+  cq_.Shutdown();
+  if (thread_.joinable()) {
+    thread_.join();
+  }
+}
 
 void OrderingGateTransportGrpc::propagateTransaction(
     std::shared_ptr<const shared_model::interface::Transaction> transaction) {
   log_->info("Propagate tx (on transport)");
-  auto call = new AsyncClientCall;
 
-  auto transaction_transport =
+  protocol::TxList list;
+  *list.add_transactions() =
       static_cast<const shared_model::proto::Transaction &>(*transaction)
           .getTransport();
-  log_->debug("Propagating: '{}'", transaction_transport.DebugString());
-  call->response_reader =
-      client_->AsynconTransaction(&call->context, transaction_transport, &cq_);
-
-  call->response_reader->Finish(&call->reply, &call->status, call);
+  log_->debug("Propagating: '{}'", list.transactions(0).DebugString());
+  enqueue(std::move(list));
 }
 
 void OrderingGateTransportGrpc::propagateBatch(
     const shared_model::interface::TransactionBatch &batch) {
   log_->info("Propagate transaction batch (on transport)");
-  auto call = new AsyncClientCall;
 
-  iroha::protocol::TxList batch_transport;
-  for (const auto tx : batch.transactions()) {
-    new (batch_transport.add_transactions()) iroha::protocol::Transaction(
+  protocol::TxList list;
+  for (const auto &tx : batch.transactions()) {
+    *list.add_transactions() =
         std::static_pointer_cast<shared_model::proto::Transaction>(tx)
-            ->getTransport());
+            ->getTransport();
   }
+  enqueue(std::move(list));
+}
+
+void OrderingGateTransportGrpc::enqueue(protocol::TxList list) {
+  {
+    std::lock_guard<std::mutex> lock(pending_mutex_);
+    if (pending_.batches_size() == 0) {
+      flush_deadline_ = std::chrono::steady_clock::now() + kFlushDelay;
+    }
+    pending_transactions_ += list.transactions_size();
+    *pending_.add_batches() = std::move(list);
+  }
+  pending_cv_.notify_one();
+}
+
+void OrderingGateTransportGrpc::run() {
+  std::unique_lock<std::mutex> lock(pending_mutex_);
+  while (true) {
+    pending_cv_.wait(
+        lock, [this] { return stop_ or pending_.batches_size() != 0; });
+    if (pending_.batches_size() == 0) {
+      break;
+    }
+    // the first transaction of the frame waits for a short time, so that
+    // transactions received meanwhile share its call
+    pending_cv_.wait_until(lock, flush_deadline_, [this] {
+      return stop_ or pending_transactions_ >= kMaxFrameTransactions;
+    });
+
+    proto::BatchList frame;
+    frame.Swap(&pending_);
+    pending_transactions_ = 0;
+    lock.unlock();
+    send(frame);
+    lock.lock();
+  }
+}
+
+void OrderingGateTransportGrpc::send(const proto::BatchList &frame) {
+  log_->info("Send {} batches to ordering service", frame.batches_size());
+  auto call = new AsyncClientCall;
+  call->address = server_address_;
+  call->on_success = [this](const proto::BatchesResponse &response) {
+    auto subscriber = subscriber_.lock();
+    if (response.rejected_hashes_size() == 0 or not subscriber) {
+      return;
+    }
+    network::OrderingRejection rejection;
+    for (const auto &hash : response.rejected_hashes()) {
+      rejection.hashes.emplace_back(hash);
+    }
+    rejection.queue_size = response.queue_size();
+    subscriber->onRejection(std::move(rejection));
+  };
   call->response_reader =
-      client_->AsynconBatch(&call->context, batch_transport, &cq_);
+      channels_->client<proto::OrderingServiceTransportGrpc>(server_address_)
+          ->AsynconBatches(&call->context, frame, &cq_);
 
   call->response_reader->Finish(&call->reply, &call->status, call);
 }
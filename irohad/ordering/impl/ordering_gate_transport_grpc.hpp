@@ -17,14 +17,22 @@
 #ifndef IROHA_ORDERING_GATE_TRANSPORT_GRPC_H
 #define IROHA_ORDERING_GATE_TRANSPORT_GRPC_H
 
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
 #include <google/protobuf/empty.pb.h>
 
+#include "ametsuchi/peer_query.hpp"
 #include "backend/protobuf/proto_proposal_factory.hpp"
 #include "interfaces/iroha_internal/transaction_batch.hpp"
 #include "logger/logger.hpp"
 #include "network/impl/async_grpc_client.hpp"
 #include "network/ordering_gate_transport.hpp"
 #include "ordering.grpc.pb.h"
+#include "ordering/impl/proposal_relay.hpp"
 #include "validators/default_validator.hpp"
 
 namespace shared_model {
@@ -35,17 +43,57 @@ namespace shared_model {
 
 namespace iroha {
   namespace ordering {
+    /**
+     * Transport of the ordering gate. Outgoing transactions and batches are
+     * coalesced into frames, which are sent when they are full or after short
+     * delay
+     */
     class OrderingGateTransportGrpc
         : public iroha::network::OrderingGateTransport,
           public proto::OrderingGateTransportGrpc::Service,
-          private network::AsyncGrpcClient<google::protobuf::Empty> {
+          private network::AsyncGrpcClient<proto::BatchesResponse> {
      public:
-      explicit OrderingGateTransportGrpc(const std::string &server_address);
+      /// number of transactions after which frame is sent without delay
+      static constexpr size_t kMaxFrameTransactions = 1000;
+
+      /// maximum time for which transaction waits for others in the frame
+      static constexpr std::chrono::milliseconds kFlushDelay{5};
+
+      /**
+       * @param server_address - address of the ordering service
+       * @param channels - pool of channels to other peers
+       * @param peer_query - ledger peers, to which relayed proposals may be
+       * forwarded. Relayed proposals are not forwarded if it is not set
+       */
+      OrderingGateTransportGrpc(
+          const std::string &server_address,
+          std::shared_ptr<network::ChannelPool> channels,
+          std::shared_ptr<ametsuchi::PeerQuery> peer_query = nullptr);
+
+      ~OrderingGateTransportGrpc() override;
 
       grpc::Status onProposal(::grpc::ServerContext *context,
                               const protocol::Proposal *request,
                               ::google::protobuf::Empty *response) override;
 
+      /**
+       * Receive proposal and forward it to the subtree given by the sender.
+       * Sender gets the reply before the proposal is forwarded and validated
+       */
+      grpc::Status onRelayedProposal(
+          ::grpc::ServerContext *context,
+          const proto::RelayedProposal *request,
+          ::google::protobuf::Empty *response) override;
+
+      /**
+       * Receive transactions dropped from the queue of ordering service,
+       * which are passed to the subscriber as rejected
+       */
+      grpc::Status onDroppedTransactions(
+          ::grpc::ServerContext *context,
+          const proto::DroppedTransactions *request,
+          ::google::protobuf::Empty *response) override;
+
       void propagateTransaction(
           std::shared_ptr<const shared_model::interface::Transaction>
               transaction) override;
@@ -57,11 +105,61 @@ namespace iroha {
                          subscriber) override;
 
      private:
+      /**
+       * Pass received proposal to the subscriber
+       */
+      void handleProposal(const protocol::Proposal &request);
+
+      /**
+       * Check that relayed proposal is forwarded only to the ledger peers
+       * @param request - relayed proposal
+       * @return true if the subtree and fanout are valid
+       */
+      bool isSubtreeValid(const proto::RelayedProposal &request);
+
+      /**
+       * Loop of the thread which forwards and handles relayed proposals
+       */
+      void processRelayed();
+
+      /**
+       * Add batch to the frame being collected
+       * @param list - transactions of the batch
+       */
+      void enqueue(protocol::TxList list);
+
+      /**
+       * Loop of the thread which sends collected frames
+       */
+      void run();
+
+      /**
+       * Send frame to the ordering service, transactions rejected by the
+       * service are passed to the subscriber
+       */
+      void send(const proto::BatchList &frame);
+
       std::weak_ptr<iroha::network::OrderingGateNotification> subscriber_;
-      std::unique_ptr<proto::OrderingServiceTransportGrpc::Stub> client_;
+      std::string server_address_;
+      std::shared_ptr<ametsuchi::PeerQuery> peer_query_;
+      ProposalRelay relay_;
       std::unique_ptr<shared_model::proto::ProtoProposalFactory<
           shared_model::validation::DefaultProposalValidator>>
           factory_;
+
+      std::mutex pending_mutex_;
+      std::condition_variable pending_cv_;
+      proto::BatchList pending_;
+      size_t pending_transactions_ = 0;
+      std::chrono::steady_clock::time_point flush_deadline_;
+      bool stop_ = false;
+      std::thread flush_thread_;
+
+      std::mutex relayed_mutex_;
+      std::condition_variable relayed_cv_;
+      std::deque<proto::RelayedProposal> relayed_;
+      bool stop_relayed_ = false;
+      std::thread relayed_thread_;
     };
 
   }  // namespace ordering
@@ -7,16 +7,23 @@
 
 #include <algorithm>
 #include <iterator>
+#include <map>
 
 #include <boost/range/adaptor/indirected.hpp>
 
-#include "ametsuchi/ordering_service_persistent_state.hpp"
 #include "ametsuchi/peer_query.hpp"
 #include "datetime/time.hpp"
 #include "network/ordering_service_transport.hpp"
 
 namespace iroha {
   namespace ordering {
+
+    constexpr std::chrono::minutes OrderingServiceImpl::kDefaultDuplicateWindow;
+    constexpr size_t OrderingServiceImpl::kLanes;
+
+    OrderingServiceImpl::Lane::Lane(std::chrono::milliseconds duplicate_window)
+        : recent_hashes(duplicate_window) {}
+
     OrderingServiceImpl::OrderingServiceImpl(
         std::shared_ptr<ametsuchi::PeerQuery> wsv,
         size_t max_size,
@@ -25,16 +32,30 @@ namespace iroha {
         std::shared_ptr<ametsuchi::OrderingServicePersistentState>
             persistent_state,
         std::unique_ptr<shared_model::interface::ProposalFactory> factory,
-        bool is_async)
+        bool is_async,
+        QueueLimits limits,
+        std::chrono::milliseconds duplicate_window,
+        size_t height_range,
+        std::shared_ptr<ProposalController> controller,
+        rxcpp::observable<shared_model::interface::types::HeightType>
+            ledger_heights)
         : wsv_(wsv),
           max_size_(max_size),
           current_size_(0),
+          limits_(limits),
           transport_(transport),
-          persistent_state_(persistent_state),
+          proposal_heights_(std::move(persistent_state), height_range),
+          controller_(std::move(controller)),
+          last_proposal_(ProposalController::Clock::now()),
           factory_(std::move(factory)),
           log_(logger::log("OrderingServiceImpl")) {
-      // restore state of ordering service from persistent storage
-      proposal_height_ = persistent_state_->loadProposalHeight().value();
+      for (size_t i = 0; i < kLanes; ++i) {
+        lanes_.push_back(std::make_unique<Lane>(duplicate_window));
+      }
+
+      ledger_handle_ = ledger_heights.subscribe([this](auto height) {
+        proposal_heights_.align(height + 1);
+      });
 
       rxcpp::observable<ProposalEvent> timer =
           proposal_timeout.map([](auto) { return ProposalEvent::kTimerEvent; });
@@ -46,15 +67,24 @@ namespace iroha {
                         auto check_queue = [&] {
                           switch (v) {
                             case ProposalEvent::kTimerEvent:
-                              return not queue_.empty();
+                              return current_size_.load() != 0
+                                  and delayElapsed();
                             case ProposalEvent::kBatchEvent:
-                              return current_size_.load() >= max_size_;
+                              return current_size_.load() >= proposalSize();
                             default:
                               BOOST_ASSERT_MSG(false, "Unknown value");
                           }
                         };
-                        if (check_queue()) {
+                        // one event is emitted for batches which may fill
+                        // several proposals, so proposals are generated
+                        // while the queue is full
+                        while (check_queue()) {
+                          auto size = current_size_.load();
                           this->generateProposal();
+                          if (v == ProposalEvent::kTimerEvent
+                              or current_size_.load() >= size) {
+                            break;
+                          }
                         }
                       });
       };
@@ -70,50 +100,241 @@ namespace iroha {
 
     void OrderingServiceImpl::onBatch(
         shared_model::interface::TransactionBatch &&batch) {
+      std::vector<shared_model::interface::TransactionBatch> batches;
+      batches.push_back(std::move(batch));
+      onBatches(std::move(batches));
+    }
+
+    network::Admission OrderingServiceImpl::onBatches(
+        std::vector<shared_model::interface::TransactionBatch> batches) {
+      network::Admission admission;
       std::shared_lock<std::shared_timed_mutex> batch_prop_lock(
           batch_prop_mutex_);
+      // bounded queue is accounted as a whole, otherwise batches of different
+      // lanes are enqueued concurrently
+      const bool bounded = limits_.capacity != 0;
+      std::unique_lock<std::mutex> admission_lock(admission_mutex_,
+                                                  std::defer_lock);
+      if (bounded) {
+        admission_lock.lock();
+      }
 
-      current_size_.fetch_add(batch.transactions().size());
-      queue_.push(std::make_unique<shared_model::interface::TransactionBatch>(
-          std::move(batch)));
-      log_->info("Queue size is {}", current_size_.load());
+      auto now = RecentHashes::Clock::now();
+      size_t added = 0;
+      std::vector<shared_model::crypto::Hash> dropped;
+      for (auto &batch : batches) {
+        auto &lane = laneOf(batch);
+        std::unique_lock<std::mutex> lane_lock(lane.mutex, std::defer_lock);
+        if (not bounded) {
+          lane_lock.lock();
+        }
+        if (isDuplicate(lane, batch, now)
+            or not admit(batch, admission.rejected, dropped)) {
+          continue;
+        }
+        for (const auto &tx : batch.transactions()) {
+          lane.recent_hashes.insert(tx->hash(), now);
+        }
+        added += batch.transactions().size();
+        lane.size += batch.transactions().size();
+        lane.queue.push(
+            std::make_unique<shared_model::interface::TransactionBatch>(
+                std::move(batch)));
+      }
+      auto size = current_size_.load();
+      admission.queue_size = size;
+      log_->info("Queue size is {}", size);
 
+      if (admission_lock) {
+        admission_lock.unlock();
+      }
       batch_prop_lock.unlock();
 
+      // peer which has sent dropped transactions is not known, so all the
+      // peers are notified
+      if (not dropped.empty()) {
+        if (auto addresses = ledgerAddresses()) {
+          transport_->publishDropped({std::move(dropped), size}, *addresses);
+        }
+      }
+
+      if (added == 0) {
+        return admission;
+      }
+      if (controller_) {
+        controller_->onArrival(added);
+      }
+
+      // one event for all the batches, proposals are generated while the
+      // queue is full
       std::lock_guard<std::mutex> event_lock(event_mutex_);
       transactions_.get_subscriber().on_next(ProposalEvent::kBatchEvent);
+      return admission;
+    }
+
+    OrderingServiceImpl::Lane &OrderingServiceImpl::laneOf(
+        const shared_model::interface::TransactionBatch &batch) {
+      return *lanes_[laneIndex(
+          batch.transactions().front()->creatorAccountId())];
+    }
+
+    size_t OrderingServiceImpl::laneIndex(
+        const shared_model::interface::types::AccountIdType &creator) {
+      return std::hash<shared_model::interface::types::AccountIdType>{}(
+                 creator)
+          % kLanes;
+    }
+
+    bool OrderingServiceImpl::isDuplicate(
+        Lane &lane,
+        const shared_model::interface::TransactionBatch &batch,
+        RecentHashes::Clock::time_point now) {
+      const auto &transactions = batch.transactions();
+      auto duplicate =
+          std::any_of(transactions.begin(),
+                      transactions.end(),
+                      [&lane, now](const auto &tx) {
+                        return lane.recent_hashes.contains(tx->hash(), now);
+                      });
+      if (duplicate) {
+        // the whole batch is dropped, as it is a copy of the enqueued one
+        auto suppressed = suppressed_duplicates_ += transactions.size();
+        log_->info("Dropping duplicate batch of {} transactions, {} "
+                   "duplicates suppressed so far",
+                   transactions.size(),
+                   suppressed);
+      }
+      return duplicate;
+    }
+
+    bool OrderingServiceImpl::admit(
+        const shared_model::interface::TransactionBatch &batch,
+        std::vector<shared_model::crypto::Hash> &rejected,
+        std::vector<shared_model::crypto::Hash> &dropped) {
+      const auto &transactions = batch.transactions();
+      const auto size = transactions.size();
+
+      // number of transactions of each creator in the batch
+      std::map<shared_model::interface::types::AccountIdType, size_t> creators;
+      if (limits_.policy == QueuePolicy::kFairShare) {
+        for (const auto &tx : transactions) {
+          ++creators[tx->creatorAccountId()];
+        }
+      }
+
+      auto fits = [&] {
+        if (limits_.capacity == 0) {
+          return true;
+        }
+        if (current_size_.load() + size > limits_.capacity) {
+          return false;
+        }
+        if (limits_.policy != QueuePolicy::kFairShare) {
+          return true;
+        }
+        auto holders = creator_sizes_.size();
+        for (const auto &creator : creators) {
+          if (creator_sizes_.count(creator.first) == 0) {
+            ++holders;
+          }
+        }
+        auto share = limits_.capacity / holders;
+        return std::all_of(
+            creators.begin(), creators.end(), [&](const auto &creator) {
+              auto it = creator_sizes_.find(creator.first);
+              auto held = it == creator_sizes_.end() ? 0 : it->second;
+              return held + creator.second <= share;
+            });
+      };
+
+      if (limits_.policy == QueuePolicy::kDropOldest
+          and size <= limits_.capacity) {
+        while (not fits()) {
+          // the oldest batch of the longest lane is dropped
+          auto &lane = **std::max_element(
+              lanes_.begin(), lanes_.end(), [](const auto &a, const auto &b) {
+                return a->size.load() < b->size.load();
+              });
+          std::unique_ptr<shared_model::interface::TransactionBatch> oldest =
+              std::move(lane.head);
+          if (not oldest and not lane.queue.try_pop(oldest)) {
+            break;
+          }
+          log_->warn("Queue is full, dropping batch of {} transactions",
+                     oldest->transactions().size());
+          // client may resend dropped transactions
+          for (const auto &tx : oldest->transactions()) {
+            dropped.push_back(tx->hash());
+            lane.recent_hashes.erase(tx->hash());
+          }
+          release(lane, *oldest);
+        }
+      }
+
+      if (not fits()) {
+        log_->warn("Queue is full, rejecting batch of {} transactions", size);
+        for (const auto &tx : transactions) {
+          rejected.push_back(tx->hash());
+        }
+        return false;
+      }
+
+      current_size_.fetch_add(size);
+      for (const auto &creator : creators) {
+        creator_sizes_[creator.first] += creator.second;
+      }
+      return true;
+    }
+
+    void OrderingServiceImpl::release(
+        Lane &lane, const shared_model::interface::TransactionBatch &batch) {
+      current_size_ -= batch.transactions().size();
+      lane.size -= batch.transactions().size();
+      if (limits_.policy != QueuePolicy::kFairShare) {
+        return;
+      }
+      for (const auto &tx : batch.transactions()) {
+        auto it = creator_sizes_.find(tx->creatorAccountId());
+        if (it != creator_sizes_.end() and --it->second == 0) {
+          creator_sizes_.erase(it);
+        }
+      }
     }
 
     void OrderingServiceImpl::generateProposal() {
       std::lock_guard<std::shared_timed_mutex> lock(batch_prop_mutex_);
       log_->info("Start proposal generation");
       std::vector<std::shared_ptr<shared_model::interface::Transaction>> txs;
-      for (std::unique_ptr<shared_model::interface::TransactionBatch> batch;
-           txs.size() < max_size_ and queue_.try_pop(batch);) {
-        auto batch_size = batch->transactions().size();
+      for (auto &batch : drainLanes(proposalSize())) {
         txs.insert(std::end(txs),
             std::make_move_iterator(std::begin(batch->transactions())),
             std::make_move_iterator(std::end(batch->transactions())));
-        current_size_ -= batch_size;
+      }
+
+      last_proposal_ = ProposalController::Clock::now();
+      if (controller_) {
+        controller_->onProposal(txs.size(), last_proposal_);
+      }
+
+      // height is taken from the range reserved in the persistent storage,
+      // it is the next block height unless the ledger is behind the proposals
+      auto height = proposal_heights_.next();
+      if (not height) {
+        // TODO(@l4l) 23/03/18: publish proposal independent of psql
+        // status IR-1162
+        log_->warn(
+            "Proposal height cannot be saved. Skipping proposal publish");
+        return;
       }
 
       auto tx_range = txs | boost::adaptors::indirected;
-      auto proposal = factory_->createProposal(
-          proposal_height_++, iroha::time::now(), tx_range);
+      auto proposal =
+          factory_->createProposal(*height, iroha::time::now(), tx_range);
 
       proposal.match(
           [this](expected::Value<
                  std::unique_ptr<shared_model::interface::Proposal>> &v) {
-            // Save proposal height to the persistent storage.
-            // In case of restart it reloads state.
-            if (persistent_state_->saveProposalHeight(proposal_height_)) {
-              publishProposal(std::move(v.value));
-            } else {
-              // TODO(@l4l) 23/03/18: publish proposal independent of psql
-              // status IR-1162
-              log_->warn(
-                  "Proposal height cannot be saved. Skipping proposal publish");
-            }
+            publishProposal(std::move(v.value));
           },
           [this](expected::Error<std::string> &e) {
             log_->warn("Failed to initialize proposal: {}", e.error);
@@ -122,21 +343,83 @@ namespace iroha {
 
     void OrderingServiceImpl::publishProposal(
         std::unique_ptr<shared_model::interface::Proposal> proposal) {
+      if (auto addresses = ledgerAddresses()) {
+        transport_->publishProposal(std::move(proposal), *addresses);
+      }
+    }
+
+    boost::optional<std::vector<std::string>>
+    OrderingServiceImpl::ledgerAddresses() {
       auto peers = wsv_->getLedgerPeers();
-      if (peers) {
-        std::vector<std::string> addresses;
-        std::transform(peers->begin(),
-                       peers->end(),
-                       std::back_inserter(addresses),
-                       [](auto &p) { return p->address(); });
-        transport_->publishProposal(std::move(proposal), addresses);
-      } else {
+      if (not peers) {
         log_->error("Cannot get the peer list");
+        return boost::none;
+      }
+      std::vector<std::string> addresses;
+      std::transform(peers->begin(),
+                     peers->end(),
+                     std::back_inserter(addresses),
+                     [](auto &p) { return p->address(); });
+      return addresses;
+    }
+
+    std::vector<std::unique_ptr<shared_model::interface::TransactionBatch>>
+    OrderingServiceImpl::drainLanes(size_t max_size) {
+      std::vector<std::unique_ptr<shared_model::interface::TransactionBatch>>
+          batches;
+      size_t proposed = 0;
+      const auto quantum = std::max<size_t>(1, max_size / lanes_.size());
+      // lanes are visited until the proposal is full or all of them are empty
+      for (size_t empty = 0; proposed < max_size and empty < lanes_.size();
+           next_lane_ = (next_lane_ + 1) % lanes_.size()) {
+        auto &lane = *lanes_[next_lane_];
+        if (not lane.head and not lane.queue.try_pop(lane.head)) {
+          lane.deficit = 0;
+          ++empty;
+          continue;
+        }
+        empty = 0;
+
+        // lane with a big batch waits for several turns, so that lanes of
+        // small batches are not starved
+        lane.deficit += quantum;
+        while (lane.head and proposed < max_size
+               and lane.head->transactions().size() <= lane.deficit) {
+          auto size = lane.head->transactions().size();
+          lane.deficit -= size;
+          proposed += size;
+          release(lane, *lane.head);
+          // duplicates are dropped until proposal is expected to be committed
+          for (const auto &tx : lane.head->transactions()) {
+            lane.recent_hashes.touch(tx->hash());
+          }
+          batches.push_back(std::move(lane.head));
+          lane.queue.try_pop(lane.head);
+        }
+        if (not lane.head) {
+          lane.deficit = 0;
+        }
       }
+      return batches;
+    }
+
+    size_t OrderingServiceImpl::proposalSize() const {
+      return controller_ ? controller_->size() : max_size_;
+    }
+
+    bool OrderingServiceImpl::delayElapsed() const {
+      return not controller_
+          or ProposalController::Clock::now() - last_proposal_
+          >= controller_->delay();
+    }
+
+    size_t OrderingServiceImpl::suppressedDuplicates() const {
+      return suppressed_duplicates_.load();
     }
 
     OrderingServiceImpl::~OrderingServiceImpl() {
       handle_.unsubscribe();
+      ledger_handle_.unsubscribe();
     }
   }  // namespace ordering
 }  // namespace iroha
@@ -8,13 +8,19 @@
 
 #include <memory>
 #include <shared_mutex>
+#include <unordered_map>
 
 #include <tbb/concurrent_queue.h>
 #include <rxcpp/rx.hpp>
 
+#include "cache/expiring_set.hpp"
+#include "cryptography/hash.hpp"
 #include "logger/logger.hpp"
 #include "network/ordering_service.hpp"
 #include "ordering.grpc.pb.h"
+#include "ordering/impl/proposal_controller.hpp"
+#include "ordering/impl/proposal_height_allocator.hpp"
+#include "interfaces/common_objects/types.hpp"
 #include "interfaces/iroha_internal/proposal_factory.hpp"
 
 namespace iroha {
@@ -26,15 +32,49 @@ namespace iroha {
 
   namespace ordering {
 
+    /**
+     * Policy of admission of batches into the bounded queue of ordering service
+     */
+    enum class QueuePolicy {
+      /// batch which does not fit into the queue is rejected
+      kReject,
+      /// the oldest batches of the longest lanes are dropped to make room for
+      /// the new one
+      kDropOldest,
+      /// batch is rejected if the queue is full or if its creator holds more
+      /// than its share of the queue, which is the capacity divided by the
+      /// number of creators having transactions in the queue
+      kFairShare
+    };
+
+    /**
+     * Limits of the queue of ordering service
+     */
+    struct QueueLimits {
+      /// maximum number of transactions in the queue, 0 for unbounded queue
+      size_t capacity = 0;
+      QueuePolicy policy = QueuePolicy::kReject;
+    };
+
     /**
      * OrderingService implementation with gRPC synchronous server
      * Allows receiving transactions concurrently from multiple peers by using
-     * concurrent queue
-     * Sends proposal by given timer interval and proposal size
+     * concurrent queues, one per lane of creator accounts
+     * Sends proposal by given timer interval and proposal size, taking
+     * batches from the lanes in round-robin order
      */
     class OrderingServiceImpl : public network::OrderingService {
      public:
       using TimeoutType = long;
+
+      /// time for which hashes of enqueued and proposed transactions are
+      /// remembered to drop their duplicates
+      static constexpr std::chrono::minutes kDefaultDuplicateWindow{2};
+
+      /// number of lanes of the queue, batches of one creator are in the same
+      /// lane
+      static constexpr size_t kLanes = 16;
+
       /**
        * Constructor
        * @param wsv interface for fetching peers from world state view
@@ -44,6 +84,16 @@ namespace iroha {
        * @param persistent_state storage for auxiliary information
        * @param factory is used to generate proposals
        * @param is_async whether proposals are generated in a separate thread
+       * @param limits - capacity of the queue and admission policy
+       * @param duplicate_window - time for which transactions are remembered
+       * after they are enqueued or proposed
+       * @param height_range - number of proposal heights reserved in
+       * persistent state at once
+       * @param controller - tunes size of proposal and interval between
+       * proposals, which are checked on every timeout, max_size and every
+       * timeout are used if null
+       * @param ledger_heights - height of the ledger on start and after every
+       * commit, proposal heights are aligned to the next block
        */
       OrderingServiceImpl(
           std::shared_ptr<ametsuchi::PeerQuery> wsv,
@@ -53,7 +103,15 @@ namespace iroha {
           std::shared_ptr<ametsuchi::OrderingServicePersistentState>
               persistent_state,
           std::unique_ptr<shared_model::interface::ProposalFactory> factory,
-          bool is_async = true);
+          bool is_async = true,
+          QueueLimits limits = QueueLimits(),
+          std::chrono::milliseconds duplicate_window =
+              kDefaultDuplicateWindow,
+          size_t height_range = ProposalHeightAllocator::kDefaultRange,
+          std::shared_ptr<ProposalController> controller = nullptr,
+          rxcpp::observable<shared_model::interface::types::HeightType>
+              ledger_heights = rxcpp::observable<>::empty<
+                  shared_model::interface::types::HeightType>());
 
       /**
        * Process transaction(s) received from network
@@ -62,6 +120,30 @@ namespace iroha {
        */
       void onBatch(shared_model::interface::TransactionBatch &&batch) override;
 
+      /**
+       * Process batches received from network at once
+       * Enqueues transactions of all batches which are admitted by the queue
+       * policy and publishes single event
+       * @param batches - received batches
+       * @return transactions which are not in the queue and its size
+       */
+      network::Admission onBatches(
+          std::vector<shared_model::interface::TransactionBatch> batches)
+          override;
+
+      /**
+       * @return number of received transactions which were dropped as
+       * duplicates of recently enqueued or proposed ones
+       */
+      size_t suppressedDuplicates() const;
+
+      /**
+       * @param creator - creator of the first transaction of a batch
+       * @return index of the lane of the batch
+       */
+      static size_t laneIndex(
+          const shared_model::interface::types::AccountIdType &creator);
+
       ~OrderingServiceImpl() override;
 
      protected:
@@ -73,22 +155,112 @@ namespace iroha {
           std::unique_ptr<shared_model::interface::Proposal> proposal) override;
 
      private:
+      using RecentHashes =
+          cache::ExpiringSet<shared_model::crypto::Hash,
+                             shared_model::crypto::Hash::Hasher>;
+
       /**
        * Events for queue check strategy
        */
       enum class ProposalEvent { kBatchEvent, kTimerEvent };
 
+      /**
+       * Part of the queue holding batches of some creators
+       */
+      struct Lane {
+        explicit Lane(std::chrono::milliseconds duplicate_window);
+
+        tbb::concurrent_queue<
+            std::unique_ptr<shared_model::interface::TransactionBatch>>
+            queue;
+
+        /// batch taken from the queue which is waiting for its turn, and
+        /// number of transactions which the lane may still add to proposal,
+        /// accessed under exclusive batch_prop_mutex_ or admission_mutex_
+        std::unique_ptr<shared_model::interface::TransactionBatch> head;
+        size_t deficit = 0;
+
+        /// number of transactions in the lane
+        std::atomic<size_t> size{0};
+
+        /// guards enqueue into the lane if the queue is unbounded, otherwise
+        /// batches are enqueued under admission_mutex_
+        std::mutex mutex;
+
+        /// hashes of recently enqueued and proposed transactions of the lane,
+        /// a transaction and its duplicate are in the same batch, so they are
+        /// in the same lane
+        RecentHashes recent_hashes;
+      };
+
+      /**
+       * @return lane of the creator of the first transaction of the batch
+       */
+      Lane &laneOf(const shared_model::interface::TransactionBatch &batch);
+
+      /**
+       * Take batches from the lanes in deficit round-robin order, so that
+       * every lane gets the same number of transactions into proposal, on its
+       * turn a lane may add max_size / kLanes more transactions
+       * @param max_size - size of the proposal
+       * @return batches of the proposal
+       */
+      std::vector<std::unique_ptr<shared_model::interface::TransactionBatch>>
+      drainLanes(size_t max_size);
+
       /**
        * Collect transactions from queue
        * Passes the generated proposal to publishProposal
        */
       void generateProposal() override;
 
+      /**
+       * Check whether any transaction of the batch has been recently enqueued
+       * or proposed, counting such batch as suppressed duplicate
+       */
+      bool isDuplicate(Lane &lane,
+                       const shared_model::interface::TransactionBatch &batch,
+                       RecentHashes::Clock::time_point now);
+
+      /**
+       * Check whether batch fits into the queue according to the policy and
+       * account its transactions, dropping the oldest batches if needed
+       * @param batch - batch to be enqueued
+       * @param rejected - collects hashes of transactions of rejected batch
+       * @param dropped - collects hashes of dropped transactions
+       * @return true if the batch should be enqueued
+       */
+      bool admit(const shared_model::interface::TransactionBatch &batch,
+                 std::vector<shared_model::crypto::Hash> &rejected,
+                 std::vector<shared_model::crypto::Hash> &dropped);
+
+      /**
+       * Remove transactions of the batch taken from the lane from accounting
+       */
+      void release(Lane &lane,
+                   const shared_model::interface::TransactionBatch &batch);
+
+      /**
+       * @return addresses of the ledger peers, none if they cannot be fetched
+       */
+      boost::optional<std::vector<std::string>> ledgerAddresses();
+
+      /**
+       * @return number of transactions which fill the proposal
+       */
+      size_t proposalSize() const;
+
+      /**
+       * @return whether proposal should be created on timeout
+       */
+      bool delayElapsed() const;
+
       std::shared_ptr<ametsuchi::PeerQuery> wsv_;
 
-      tbb::concurrent_queue<
-          std::unique_ptr<shared_model::interface::TransactionBatch>>
-          queue_;
+      std::vector<std::unique_ptr<Lane>> lanes_;
+
+      /// lane which takes the first turn in the next proposal
+      size_t next_lane_ = 0;
 
       /**
        * max number of txs in proposal
@@ -100,21 +272,33 @@ namespace iroha {
        */
       std::atomic_ulong current_size_;
 
-      std::shared_ptr<network::OrderingServiceTransport> transport_;
+      const QueueLimits limits_;
 
-      /**
-       * Persistent storage for proposal counter.
-       * In case of relaunch, ordering server will enumerate proposals
-       * consecutively.
-       */
-      std::shared_ptr<ametsuchi::OrderingServicePersistentState>
-          persistent_state_;
+      /// number of queued transactions of each creator, maintained for fair
+      /// share policy only
+      std::unordered_map<shared_model::interface::types::AccountIdType, size_t>
+          creator_sizes_;
+
+      std::atomic<size_t> suppressed_duplicates_{0};
+
+      std::shared_ptr<network::OrderingServiceTransport> transport_;
 
       /**
        * Proposal counter of expected proposal. Should be number of blocks in
-       * the ledger + 1.
+       * the ledger + 1, so it is aligned to the ledger on start and on every
+       * commit. Reserved heights are kept in persistent storage, so in case
+       * of relaunch without the ledger height ordering service does not reuse
+       * them.
        */
-      size_t proposal_height_;
+      ProposalHeightAllocator proposal_heights_;
+
+      /// subscription to the heights of the ledger
+      rxcpp::composite_subscription ledger_handle_;
+
+      std::shared_ptr<ProposalController> controller_;
+
+      /// time of the last proposal, accessed from proposal events only
+      ProposalController::Clock::time_point last_proposal_;
 
       /// Observable for transaction events from the network
       rxcpp::subjects::subject<ProposalEvent> transactions_;
@@ -129,6 +313,9 @@ namespace iroha {
       std::shared_timed_mutex batch_prop_mutex_;
       /// mutex for events activating
       std::mutex event_mutex_;
+      /// mutex for admission of batches into bounded queue, taken under shared
+      /// batch_prop_mutex_
+      std::mutex admission_mutex_;
 
       std::unique_ptr<shared_model::interface::ProposalFactory> factory_;
 
@@ -19,7 +19,6 @@
 #include "backend/protobuf/transaction.hpp"
 #include "builders/protobuf/proposal.hpp"
 #include "interfaces/common_objects/transaction_sequence_common.hpp"
-#include "network/impl/grpc_channel_builder.hpp"
 #include "validators/default_validator.hpp"
 
 using namespace iroha::ordering;
@@ -29,32 +28,76 @@ void OrderingServiceTransportGrpc::subscribe(
   subscriber_ = subscriber;
 }
 
+namespace {
+  /**
+   * Create batch of single transaction received from network
+   */
+  auto createBatch(const iroha::protocol::Transaction &transaction) {
+    return shared_model::interface::TransactionBatch::createTransactionBatch<
+        shared_model::validation::DefaultTransactionValidator>(
+        std::make_shared<shared_model::proto::Transaction>(
+            iroha::protocol::Transaction(transaction)));
+  }
+
+  /**
+   * Create batch of transaction list received from network
+   */
+  auto createBatch(const iroha::protocol::TxList &list) {
+    auto txs =
+        std::vector<std::shared_ptr<shared_model::interface::Transaction>>(
+            list.transactions_size());
+    std::transform(
+        std::begin(list.transactions()),
+        std::end(list.transactions()),
+        std::begin(txs),
+        [](const auto &tx) {
+          return std::make_shared<shared_model::proto::Transaction>(tx);
+        });
+
+    return shared_model::interface::TransactionBatch::createTransactionBatch(
+        txs,
+        shared_model::validation::SignedTransactionsCollectionValidator<
+            shared_model::validation::DefaultTransactionValidator,
+            shared_model::validation::BatchOrderValidator>());
+  }
+}  // namespace
+
+grpc::Status OrderingServiceTransportGrpc::enqueue(
+    iroha::expected::Result<shared_model::interface::TransactionBatch,
+                            std::string> batch_result) {
+  auto subscriber = subscriber_.lock();
+  if (not subscriber) {
+    log_->error("No subscriber");
+    return ::grpc::Status::OK;
+  }
+
+  return batch_result.match(
+      [&](iroha::expected::Value<shared_model::interface::TransactionBatch>
+              &batch) {
+        std::vector<shared_model::interface::TransactionBatch> batches;
+        batches.push_back(std::move(batch.value));
+        auto admission = subscriber->onBatches(std::move(batches));
+        if (admission.rejected.empty()) {
+          return ::grpc::Status::OK;
+        }
+        return ::grpc::Status(grpc::StatusCode::RESOURCE_EXHAUSTED,
+                              "ordering queue is full, "
+                                  + std::to_string(admission.queue_size)
+                                  + " transactions");
+      },
+      [this](const iroha::expected::Error<std::string> &error) {
+        log_->error("Could not create batch from received transactions: {}",
+                    error.error);
+        return ::grpc::Status::OK;
+      });
+}
+
 grpc::Status OrderingServiceTransportGrpc::onTransaction(
     ::grpc::ServerContext *context,
     const iroha::protocol::Transaction *request,
     ::google::protobuf::Empty *response) {
   log_->info("OrderingServiceTransportGrpc::onTransaction");
-  if (subscriber_.expired()) {
-    log_->error("No subscriber");
-  } else {
-    auto batch_result =
-        shared_model::interface::TransactionBatch::createTransactionBatch<
-            shared_model::validation::DefaultTransactionValidator>(
-            std::make_shared<shared_model::proto::Transaction>(
-                iroha::protocol::Transaction(*request)));
-    batch_result.match(
-        [this](iroha::expected::Value<shared_model::interface::TransactionBatch>
-                   &batch) {
-          subscriber_.lock()->onBatch(std::move(batch.value));
-        },
-        [this](const iroha::expected::Error<std::string> &error) {
-          log_->error(
-              "Could not create batch from received single transaction: {}",
-              error.error);
-        });
-  }
-
-  return ::grpc::Status::OK;
+  return enqueue(createBatch(*request));
 }
 
 grpc::Status OrderingServiceTransportGrpc::onBatch(
@@ -62,37 +105,41 @@ grpc::Status OrderingServiceTransportGrpc::onBatch(
     const protocol::TxList *request,
     ::google::protobuf::Empty *response) {
   log_->info("OrderingServiceTransportGrpc::onBatch");
-  if (subscriber_.expired()) {
+  return enqueue(createBatch(*request));
+}
+
+grpc::Status OrderingServiceTransportGrpc::onBatches(
+    ::grpc::ServerContext *context,
+    const proto::BatchList *request,
+    proto::BatchesResponse *response) {
+  log_->info("OrderingServiceTransportGrpc::onBatches, {} batches",
+             request->batches_size());
+  auto subscriber = subscriber_.lock();
+  if (not subscriber) {
     log_->error("No subscriber");
-  } else {
-    auto txs =
-        std::vector<std::shared_ptr<shared_model::interface::Transaction>>(
-            request->transactions_size());
-    std::transform(
-        std::begin(request->transactions()),
-        std::end(request->transactions()),
-        std::begin(txs),
-        [](const auto &tx) {
-          return std::make_shared<shared_model::proto::Transaction>(tx);
-        });
+    return ::grpc::Status::OK;
+  }
 
-    auto batch_result =
-        shared_model::interface::TransactionBatch::createTransactionBatch(
-            txs,
-            shared_model::validation::SignedTransactionsCollectionValidator<
-                shared_model::validation::DefaultTransactionValidator,
-                shared_model::validation::BatchOrderValidator>());
+  // invalid batch is dropped without affecting other batches of the list
+  std::vector<shared_model::interface::TransactionBatch> batches;
+  for (const auto &list : request->batches()) {
+    auto batch_result = list.transactions_size() == 1
+        ? createBatch(list.transactions(0))
+        : createBatch(list);
     batch_result.match(
-        [this](iroha::expected::Value<shared_model::interface::TransactionBatch>
-                   &batch) {
-          subscriber_.lock()->onBatch(std::move(batch.value));
-        },
+        [&batches](
+            iroha::expected::Value<shared_model::interface::TransactionBatch>
+                &batch) { batches.push_back(std::move(batch.value)); },
         [this](const iroha::expected::Error<std::string> &error) {
-          log_->error(
-              "Could not create batch from received transaction list: {}",
-              error.error);
+          log_->error("Could not create batch from received list: {}",
+                      error.error);
         });
   }
+  auto admission = subscriber->onBatches(std::move(batches));
+  for (const auto &hash : admission.rejected) {
+    response->add_rejected_hashes(shared_model::crypto::toBinaryString(hash));
+  }
+  response->set_queue_size(admission.queue_size);
   return ::grpc::Status::OK;
 }
 
@@ -100,26 +147,51 @@ void OrderingServiceTransportGrpc::publishProposal(
     std::unique_ptr<shared_model::interface::Proposal> proposal,
     const std::vector<std::string> &peers) {
   log_->info("OrderingServiceTransportGrpc::publishProposal");
-  std::unordered_map<std::string,
-                     std::unique_ptr<proto::OrderingGateTransportGrpc::Stub>>
-      peers_map;
+  const auto &transport =
+      static_cast<shared_model::proto::Proposal *>(proposal.get())
+          ->getTransport();
+  log_->debug("Publishing proposal: '{}'", transport.DebugString());
+  if (relay_) {
+    relay_->relay(transport, peers, relay_fanout_);
+    return;
+  }
   for (const auto &peer : peers) {
-    peers_map[peer] =
-        network::createClient<proto::OrderingGateTransportGrpc>(peer);
+    auto call = new AsyncClientCall;
+    call->address = peer;
+    call->response_reader =
+        channels_->client<proto::OrderingGateTransportGrpc>(peer)
+            ->AsynconProposal(&call->context, transport, &cq_);
+
+    call->response_reader->Finish(&call->reply, &call->status, call);
   }
+}
 
-  for (const auto &peer : peers_map) {
+void OrderingServiceTransportGrpc::publishDropped(
+    const network::OrderingRejection &dropped,
+    const std::vector<std::string> &peers) {
+  log_->info("OrderingServiceTransportGrpc::publishDropped, {} transactions",
+             dropped.hashes.size());
+  proto::DroppedTransactions request;
+  for (const auto &hash : dropped.hashes) {
+    request.add_hashes(shared_model::crypto::toBinaryString(hash));
+  }
+  request.set_queue_size(dropped.queue_size);
+  for (const auto &peer : peers) {
     auto call = new AsyncClientCall;
-    auto proto = static_cast<shared_model::proto::Proposal *>(proposal.get());
-    log_->debug("Publishing proposal: '{}'",
-                proto->getTransport().DebugString());
-    call->response_reader = peer.second->AsynconProposal(
-        &call->context, proto->getTransport(), &cq_);
+    call->address = peer;
+    call->response_reader =
+        channels_->client<proto::OrderingGateTransportGrpc>(peer)
+            ->AsynconDroppedTransactions(&call->context, request, &cq_);
 
     call->response_reader->Finish(&call->reply, &call->status, call);
   }
 }
 
-OrderingServiceTransportGrpc::OrderingServiceTransportGrpc()
+OrderingServiceTransportGrpc::OrderingServiceTransportGrpc(
+    std::shared_ptr<network::ChannelPool> channels, size_t relay_fanout)
     : network::AsyncGrpcClient<google::protobuf::Empty>(
-          logger::log("OrderingServiceTransportGrpc")) {}
+          logger::log("OrderingServiceTransportGrpc"), std::move(channels)),
+      relay_fanout_(relay_fanout),
+      relay_(relay_fanout_ == 0
+                 ? nullptr
+                 : std::make_unique<ProposalRelay>(channels_)) {}
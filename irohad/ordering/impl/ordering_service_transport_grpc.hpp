@@ -23,6 +23,7 @@
 #include "network/impl/async_grpc_client.hpp"
 #include "network/ordering_service_transport.hpp"
 #include "ordering.grpc.pb.h"
+#include "ordering/impl/proposal_relay.hpp"
 #include "transaction.pb.h"
 
 namespace iroha {
@@ -33,7 +34,16 @@ namespace iroha {
           public proto::OrderingServiceTransportGrpc::Service,
           network::AsyncGrpcClient<google::protobuf::Empty> {
      public:
-      OrderingServiceTransportGrpc();
+      /**
+       * @param channels - pool of channels to other peers
+       * @param relay_fanout - number of peers to which proposal is sent, the
+       * rest of peers receive it along the fanout tree. Proposal is sent to
+       * every peer directly if fanout is 0
+       */
+      explicit OrderingServiceTransportGrpc(
+          std::shared_ptr<network::ChannelPool> channels,
+          size_t relay_fanout = 0);
+
       void subscribe(
           std::shared_ptr<iroha::network::OrderingServiceNotification>
               subscriber) override;
@@ -42,18 +52,48 @@ namespace iroha {
           std::unique_ptr<shared_model::interface::Proposal> proposal,
           const std::vector<std::string> &peers) override;
 
+      void publishDropped(const network::OrderingRejection &dropped,
+                          const std::vector<std::string> &peers) override;
+
+      /**
+       * Receive single transaction, RESOURCE_EXHAUSTED is returned if it is
+       * rejected by the queue of ordering service
+       */
       grpc::Status onTransaction(::grpc::ServerContext *context,
                                  const protocol::Transaction *request,
                                  ::google::protobuf::Empty *response) override;
 
+      /**
+       * Receive batch, RESOURCE_EXHAUSTED is returned if it is rejected by
+       * the queue of ordering service
+       */
       grpc::Status onBatch(::grpc::ServerContext *context,
                            const protocol::TxList *request,
                            ::google::protobuf::Empty *response) override;
 
+      /**
+       * Receive transactions and batches coalesced by the gate, batches are
+       * passed to the subscriber at once. Response contains hashes of the
+       * transactions rejected by the queue and its size
+       */
+      grpc::Status onBatches(::grpc::ServerContext *context,
+                             const proto::BatchList *request,
+                             proto::BatchesResponse *response) override;
+
       ~OrderingServiceTransportGrpc() = default;
 
      private:
+      /**
+       * Pass single batch to the subscriber
+       * @return status of the call depending on admission of the batch
+       */
+      grpc::Status enqueue(
+          iroha::expected::Result<shared_model::interface::TransactionBatch,
+                                  std::string> batch_result);
+
       std::weak_ptr<iroha::network::OrderingServiceNotification> subscriber_;
+      size_t relay_fanout_;
+      std::unique_ptr<ProposalRelay> relay_;
     };
 
   }  // namespace ordering
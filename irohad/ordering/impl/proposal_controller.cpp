@@ -0,0 +1,123 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ordering/impl/proposal_controller.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <tuple>
+
+namespace iroha {
+  namespace ordering {
+
+    constexpr double ProposalController::kSmoothing;
+
+    ProposalController::ProposalController(
+        ProposalBounds bounds, const metrics::RoundMetrics &metrics)
+        : bounds_(bounds),
+          metrics_(metrics),
+          last_update_(Clock::now()),
+          log_(logger::log("ProposalController")) {
+      std::tie(processed_us_, processed_rounds_) = processed();
+      auto tuning = tune(bounds_, 0, std::chrono::microseconds(0));
+      size_ = tuning.size;
+      delay_us_ = tuning.delay.count();
+    }
+
+    void ProposalController::onArrival(size_t transactions) {
+      arrived_ += transactions;
+    }
+
+    void ProposalController::onProposal(size_t transactions,
+                                        Clock::time_point now) {
+      auto smooth = [](double &estimate, bool &has_estimate, double sample) {
+        estimate = has_estimate
+            ? estimate + kSmoothing * (sample - estimate)
+            : sample;
+        has_estimate = true;
+      };
+
+      std::chrono::duration<double> elapsed = now - last_update_;
+      if (elapsed.count() > 0) {
+        smooth(arrival_rate_,
+               has_rate_,
+               arrived_.exchange(0) / elapsed.count());
+        last_update_ = now;
+      }
+
+      // rounds finished since the last sample processed the transactions
+      // proposed before this proposal
+      uint64_t processed_us, processed_rounds;
+      std::tie(processed_us, processed_rounds) = processed();
+      if (processed_rounds > processed_rounds_ and proposed_ > 0) {
+        smooth(cost_us_,
+               has_cost_,
+               static_cast<double>(processed_us - processed_us_) / proposed_);
+        processed_us_ = processed_us;
+        processed_rounds_ = processed_rounds;
+        proposed_ = 0;
+      }
+      proposed_ += transactions;
+
+      auto tuning = tune(
+          bounds_,
+          arrival_rate_,
+          std::chrono::microseconds(static_cast<int64_t>(cost_us_)));
+      size_ = tuning.size;
+      delay_us_ = tuning.delay.count();
+      log_->debug("Arrival rate {} tx/s, cost {} us/tx, proposal size {}, "
+                  "delay {} us",
+                  arrival_rate_,
+                  cost_us_,
+                  tuning.size,
+                  tuning.delay.count());
+    }
+
+    size_t ProposalController::size() const {
+      return size_.load();
+    }
+
+    std::chrono::microseconds ProposalController::delay() const {
+      return std::chrono::microseconds(delay_us_.load());
+    }
+
+    ProposalController::Tuning ProposalController::tune(
+        const ProposalBounds &bounds,
+        double arrival_rate,
+        std::chrono::microseconds cost) {
+      using Seconds = std::chrono::duration<double>;
+      const auto target = Seconds(bounds.latency_target).count();
+      const auto cost_s = Seconds(cost).count();
+
+      // transaction waits for the proposal and then for its processing, so
+      // latency is delay + rate * delay * cost
+      auto delay_s = std::min(
+          std::max(target / (1 + arrival_rate * cost_s),
+                   Seconds(bounds.min_delay).count()),
+          Seconds(bounds.max_delay).count());
+
+      auto size = arrival_rate * delay_s;
+      // processing of the proposal should not exceed the rest of the target
+      // when the delay is raised to the lower bound
+      if (cost_s > 0 and target > delay_s) {
+        size = std::min(size, (target - delay_s) / cost_s);
+      }
+      auto bounded_size = std::min(
+          std::max(static_cast<size_t>(std::ceil(size)), bounds.min_size),
+          bounds.max_size);
+
+      return {bounded_size,
+              std::chrono::duration_cast<std::chrono::microseconds>(
+                  Seconds(delay_s))};
+    }
+
+    std::pair<uint64_t, uint64_t> ProposalController::processed() const {
+      auto validation = metrics_.histogram(metrics::Phase::kValidation);
+      auto commit = metrics_.histogram(metrics::Phase::kCommit);
+      return {validation.sum_us + commit.sum_us, commit.count};
+    }
+
+  }  // namespace ordering
+}  // namespace iroha
@@ -0,0 +1,122 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_PROPOSAL_CONTROLLER_HPP
+#define IROHA_PROPOSAL_CONTROLLER_HPP
+
+#include <atomic>
+#include <chrono>
+
+#include "logger/logger.hpp"
+#include "metrics/round_metrics.hpp"
+
+namespace iroha {
+  namespace ordering {
+
+    /**
+     * Bounds of adaptive proposal size and interval
+     */
+    struct ProposalBounds {
+      size_t min_size = 1;
+      size_t max_size = 1;
+      std::chrono::milliseconds min_delay{0};
+      std::chrono::milliseconds max_delay{0};
+      /// time from arrival of transaction to commit of its block, which the
+      /// controller tries to keep
+      std::chrono::milliseconds latency_target{0};
+    };
+
+    /**
+     * Controller of proposal size and interval. Arrival rate of transactions
+     * and time of stateful validation and commit per transaction are
+     * measured, the proposal holds transactions arrived during the interval,
+     * and the interval is chosen so that waiting for the proposal plus
+     * processing of it fits into the latency target
+     */
+    class ProposalController {
+     public:
+      using Clock = std::chrono::steady_clock;
+
+      /// weight of the new sample in the moving averages
+      static constexpr double kSmoothing = 0.2;
+
+      struct Tuning {
+        size_t size;
+        std::chrono::microseconds delay;
+      };
+
+      /**
+       * @param bounds - bounds of size and interval and the latency target
+       * @param metrics - source of validation and commit durations
+       */
+      explicit ProposalController(
+          ProposalBounds bounds,
+          const metrics::RoundMetrics &metrics = metrics::roundMetrics());
+
+      /**
+       * Count transactions which arrived to the queue
+       */
+      void onArrival(size_t transactions);
+
+      /**
+       * Update the estimates and the tuning when a proposal is created, not
+       * thread safe
+       * @param transactions - size of the proposal
+       * @param now - time of the proposal
+       */
+      void onProposal(size_t transactions, Clock::time_point now);
+
+      /**
+       * @return current size of proposal
+       */
+      size_t size() const;
+
+      /**
+       * @return current interval between proposals
+       */
+      std::chrono::microseconds delay() const;
+
+      /**
+       * Choose size and interval for given load
+       * @param bounds - bounds of size and interval and the latency target
+       * @param arrival_rate - transactions per second
+       * @param cost - time of validation and commit of one transaction
+       * @return tuning within the bounds
+       */
+      static Tuning tune(const ProposalBounds &bounds,
+                         double arrival_rate,
+                         std::chrono::microseconds cost);
+
+     private:
+      /**
+       * @return sum of durations and count of rounds of validation and commit
+       */
+      std::pair<uint64_t, uint64_t> processed() const;
+
+      const ProposalBounds bounds_;
+      const metrics::RoundMetrics &metrics_;
+
+      std::atomic<size_t> arrived_{0};
+
+      /// estimates, modified by onProposal only
+      double arrival_rate_ = 0;
+      double cost_us_ = 0;
+      bool has_rate_ = false;
+      bool has_cost_ = false;
+      Clock::time_point last_update_;
+      uint64_t processed_us_;
+      uint64_t processed_rounds_;
+      size_t proposed_ = 0;
+
+      std::atomic<size_t> size_;
+      std::atomic<int64_t> delay_us_;
+
+      logger::Logger log_;
+    };
+
+  }  // namespace ordering
+}  // namespace iroha
+
+#endif  // IROHA_PROPOSAL_CONTROLLER_HPP
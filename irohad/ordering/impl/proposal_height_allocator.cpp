@@ -0,0 +1,89 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ordering/impl/proposal_height_allocator.hpp"
+
+#include <algorithm>
+
+#include "ametsuchi/ordering_service_persistent_state.hpp"
+
+namespace iroha {
+  namespace ordering {
+
+    constexpr size_t ProposalHeightAllocator::kDefaultRange;
+
+    ProposalHeightAllocator::ProposalHeightAllocator(
+        std::shared_ptr<ametsuchi::OrderingServicePersistentState>
+            persistent_state,
+        size_t range)
+        : persistent_state_(std::move(persistent_state)),
+          range_(range),
+          next_(persistent_state_->loadProposalHeight().value()),
+          reserved_(next_),
+          log_(logger::log("ProposalHeightAllocator")),
+          thread_(&ProposalHeightAllocator::run, this) {}
+
+    ProposalHeightAllocator::~ProposalHeightAllocator() {
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+      }
+      cv_.notify_all();
+      thread_.join();
+    }
+
+    boost::optional<size_t> ProposalHeightAllocator::next() {
+      std::unique_lock<std::mutex> lock(mutex_);
+      cv_.wait(lock, [this] { return not prefetch_ or next_ < reserved_; });
+
+      if (next_ >= reserved_) {
+        // the next range was not reserved in advance, e.g. the write failed
+        if (not persistent_state_->saveProposalHeight(next_ + range_)) {
+          log_->warn("Proposal heights from {} cannot be reserved", next_);
+          return boost::none;
+        }
+        reserved_ = next_ + range_;
+      }
+
+      auto height = next_++;
+      taken_ = true;
+      if (reserved_ - next_ <= range_ / 2 and not prefetch_) {
+        prefetch_ = true;
+        cv_.notify_all();
+      }
+      return height;
+    }
+
+    void ProposalHeightAllocator::align(size_t height) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      // range beyond the reserved one is saved by the next call
+      next_ = taken_ ? std::max(next_, height) : height;
+    }
+
+    void ProposalHeightAllocator::run() {
+      std::unique_lock<std::mutex> lock(mutex_);
+      while (true) {
+        cv_.wait(lock, [this] { return stop_ or prefetch_; });
+        if (stop_) {
+          break;
+        }
+
+        auto until = reserved_ + range_;
+        lock.unlock();
+        auto saved = persistent_state_->saveProposalHeight(until);
+        lock.lock();
+
+        if (saved) {
+          reserved_ = until;
+        } else {
+          log_->warn("Proposal heights up to {} cannot be reserved", until);
+        }
+        prefetch_ = false;
+        cv_.notify_all();
+      }
+    }
+
+  }  // namespace ordering
+}  // namespace iroha
@@ -0,0 +1,99 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_PROPOSAL_HEIGHT_ALLOCATOR_HPP
+#define IROHA_PROPOSAL_HEIGHT_ALLOCATOR_HPP
+
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include <boost/optional.hpp>
+
+#include "logger/logger.hpp"
+
+namespace iroha {
+
+  namespace ametsuchi {
+    class OrderingServicePersistentState;
+  }  // namespace ametsuchi
+
+  namespace ordering {
+
+    /**
+     * Source of proposal heights which persists ranges of heights instead of
+     * every height. Persistent state stores the end of the reserved range, so
+     * after restart the heights continue from it unless they are aligned to
+     * the ledger. The next range is reserved in a separate thread when half of
+     * the current one is used
+     */
+    class ProposalHeightAllocator {
+     public:
+      /// number of heights reserved by a single write
+      static constexpr size_t kDefaultRange = 1000;
+
+      /**
+       * Load the first height from persistent state
+       * @param persistent_state - storage of the end of the reserved range
+       * @param range - number of heights reserved by a single write, positive
+       */
+      explicit ProposalHeightAllocator(
+          std::shared_ptr<ametsuchi::OrderingServicePersistentState>
+              persistent_state,
+          size_t range = kDefaultRange);
+
+      ~ProposalHeightAllocator();
+
+      /**
+       * Take the next height, storage is written only if the reserved range
+       * is exhausted
+       * @return the next height or none if the range cannot be reserved, in
+       * that case the height is not taken
+       */
+      boost::optional<size_t> next();
+
+      /**
+       * Continue from the height of the next block of the ledger. Until a
+       * height is taken, e.g. after restart, the allocator moves to it in
+       * either direction, since heights above the ledger were not committed.
+       * Afterwards taken heights are never reused, so the allocator only moves
+       * forward
+       * @param height - height of the next block
+       */
+      void align(size_t height);
+
+     private:
+      /**
+       * Reserve the next range when requested
+       */
+      void run();
+
+      std::shared_ptr<ametsuchi::OrderingServicePersistentState>
+          persistent_state_;
+      const size_t range_;
+
+      std::mutex mutex_;
+      std::condition_variable cv_;
+      /// height which is returned next
+      size_t next_;
+      /// heights below are reserved in persistent state
+      size_t reserved_;
+      /// whether any height is taken
+      bool taken_ = false;
+      /// whether the next range is being reserved, only one write is in
+      /// flight, so the stored value never decreases
+      bool prefetch_ = false;
+      bool stop_ = false;
+
+      logger::Logger log_;
+
+      std::thread thread_;
+    };
+
+  }  // namespace ordering
+}  // namespace iroha
+
+#endif  // IROHA_PROPOSAL_HEIGHT_ALLOCATOR_HPP
@@ -0,0 +1,109 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ordering/impl/proposal_relay.hpp"
+
+#include "cryptography/default_hash_provider.hpp"
+
+namespace iroha {
+  namespace ordering {
+
+    constexpr size_t ProposalRelay::kSeenProposals;
+    constexpr std::chrono::milliseconds ProposalRelay::kRelayTimeout;
+
+    ProposalRelay::ProposalRelay(
+        std::shared_ptr<network::ChannelPool> channels)
+        : network::AsyncGrpcClient<google::protobuf::Empty>(
+              logger::log("ProposalRelay"), std::move(channels)) {}
+
+    ProposalRelay::~ProposalRelay() {
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+      }
+      // failed calls relay the proposal from the thread of the queue, so it
+      // is stopped before the members are destroyed
+      cq_.Shutdown();
+      if (thread_.joinable()) {
+        thread_.join();
+      }
+    }
+
+    void ProposalRelay::relay(const protocol::Proposal &proposal,
+                              const std::vector<std::string> &peers,
+                              size_t fanout) {
+      for (auto &subtree : split(peers, fanout)) {
+        send(proposal, std::move(subtree), fanout);
+      }
+    }
+
+    bool ProposalRelay::accept(const protocol::Proposal &proposal) {
+      auto key = std::make_pair(
+          proposal.height(),
+          shared_model::crypto::DefaultHashProvider::makeHash(
+              shared_model::crypto::Blob(proposal.SerializeAsString()))
+              .hex());
+
+      std::lock_guard<std::mutex> lock(seen_mutex_);
+      if (not seen_.insert(key).second) {
+        return false;
+      }
+      // proposals of the lowest heights are forgotten first
+      if (seen_.size() > kSeenProposals) {
+        seen_.erase(seen_.begin());
+      }
+      return true;
+    }
+
+    std::vector<std::vector<std::string>> ProposalRelay::split(
+        const std::vector<std::string> &peers, size_t fanout) {
+      std::vector<std::vector<std::string>> subtrees;
+      auto begin = peers.begin();
+      for (size_t i = 0; i < fanout and begin != peers.end(); ++i) {
+        // remaining peers are divided between remaining subtrees rounding up
+        auto left = static_cast<size_t>(std::distance(begin, peers.end()));
+        auto size = (left + fanout - i - 1) / (fanout - i);
+        subtrees.emplace_back(begin, begin + size);
+        begin += size;
+      }
+      return subtrees;
+    }
+
+    void ProposalRelay::send(const protocol::Proposal &proposal,
+                             std::vector<std::string> subtree,
+                             size_t fanout) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (stop_) {
+        return;
+      }
+
+      proto::RelayedProposal request;
+      *request.mutable_proposal() = proposal;
+      for (auto it = std::next(subtree.begin()); it != subtree.end(); ++it) {
+        request.add_peers(*it);
+      }
+      request.set_fanout(fanout);
+
+      auto call = new AsyncClientCall;
+      call->address = subtree.front();
+      call->context.set_deadline(std::chrono::system_clock::now()
+                                 + kRelayTimeout);
+      // children of failed root are not lost, proposal is relayed to them by
+      // this peer
+      if (subtree.size() > 1) {
+        subtree.erase(subtree.begin());
+        call->on_failure = [this,
+                            proposal,
+                            subtree = std::move(subtree),
+                            fanout] { relay(proposal, subtree, fanout); };
+      }
+      call->response_reader =
+          channels_->client<proto::OrderingGateTransportGrpc>(call->address)
+              ->AsynconRelayedProposal(&call->context, request, &cq_);
+      call->response_reader->Finish(&call->reply, &call->status, call);
+    }
+
+  }  // namespace ordering
+}  // namespace iroha
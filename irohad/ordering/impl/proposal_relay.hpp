@@ -0,0 +1,98 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_PROPOSAL_RELAY_HPP
+#define IROHA_PROPOSAL_RELAY_HPP
+
+#include <chrono>
+#include <mutex>
+#include <set>
+#include <string>
+#include <vector>
+
+#include <google/protobuf/empty.pb.h>
+
+#include "interfaces/common_objects/types.hpp"
+#include "logger/logger.hpp"
+#include "network/impl/async_grpc_client.hpp"
+#include "ordering.grpc.pb.h"
+
+namespace iroha {
+  namespace ordering {
+
+    /**
+     * Dissemination of proposals along a fanout tree. Sender passes the
+     * proposal to the roots of several subtrees of peers, every root relays it
+     * further to its own subtree, so no peer sends more than fanout copies of
+     * the proposal. If a root fails, sender relays the proposal to its subtree
+     * directly
+     */
+    class ProposalRelay
+        : private network::AsyncGrpcClient<google::protobuf::Empty> {
+     public:
+      /// number of recently received proposals remembered to drop duplicates
+      static constexpr size_t kSeenProposals = 16;
+
+      /// time to wait for the root of a subtree to accept the proposal
+      static constexpr std::chrono::milliseconds kRelayTimeout{2000};
+
+      /**
+       * @param channels - pool of channels to other peers
+       */
+      explicit ProposalRelay(std::shared_ptr<network::ChannelPool> channels);
+
+      ~ProposalRelay();
+
+      /**
+       * Send proposal to the roots of the subtrees of given peers
+       * @param proposal - proposal to be sent
+       * @param peers - addresses of the peers which should receive the
+       * proposal
+       * @param fanout - maximum number of subtrees
+       */
+      void relay(const protocol::Proposal &proposal,
+                 const std::vector<std::string> &peers,
+                 size_t fanout);
+
+      /**
+       * Remember received proposal
+       * @param proposal - received proposal
+       * @return false if the proposal with the same height and hash has
+       * already been received
+       */
+      bool accept(const protocol::Proposal &proposal);
+
+      /**
+       * Split peers into subtrees of nearly equal size, the first peer of each
+       * subtree is its root
+       * @param peers - addresses of the peers
+       * @param fanout - maximum number of subtrees
+       * @return non-empty subtrees
+       */
+      static std::vector<std::vector<std::string>> split(
+          const std::vector<std::string> &peers, size_t fanout);
+
+     private:
+      /**
+       * Send proposal to the root of the subtree
+       */
+      void send(const protocol::Proposal &proposal,
+                std::vector<std::string> subtree,
+                size_t fanout);
+
+      // guards start of the calls against shutdown of the completion queue
+      std::mutex mutex_;
+      bool stop_ = false;
+
+      std::mutex seen_mutex_;
+      std::set<std::pair<shared_model::interface::types::HeightType,
+                         std::string>>
+          seen_;
+    };
+
+  }  // namespace ordering
+}  // namespace iroha
+
+#endif  // IROHA_PROPOSAL_RELAY_HPP
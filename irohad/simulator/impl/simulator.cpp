@@ -24,6 +24,7 @@
 #include "builders/protobuf/empty_block.hpp"
 #include "interfaces/iroha_internal/block.hpp"
 #include "interfaces/iroha_internal/proposal.hpp"
+#include "metrics/round_metrics.hpp"
 
 namespace iroha {
   namespace simulator {
@@ -95,9 +96,12 @@ namespace iroha {
       temporaryStorageResult.match(
           [&](expected::Value<std::unique_ptr<ametsuchi::TemporaryWsv>>
                   &temporaryStorage) {
+            metrics::PhaseTimer timer(metrics::Phase::kValidation,
+                                      proposal.height());
             auto validated_proposal_and_errors =
                 std::make_shared<iroha::validation::VerifiedProposalAndErrors>(
                     validator_->validate(proposal, *temporaryStorage.value));
+            timer.stop();
             notifier_.get_subscriber().on_next(
                 std::move(validated_proposal_and_errors));
           },
@@ -120,8 +124,10 @@ namespace iroha {
             return static_cast<const shared_model::proto::Transaction &>(tx);
           });
 
-      auto sign_and_send = [this](const auto &any_block) {
+      auto sign_and_send = [this, &proposal](const auto &any_block) {
+        metrics::PhaseTimer timer(metrics::Phase::kSigning, proposal.height());
         crypto_signer_->sign(*any_block);
+        timer.stop();
         block_notifier_.get_subscriber().on_next(any_block);
       };
 
@@ -0,0 +1,184 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "synchronizer/impl/fast_sync.hpp"
+
+#include <algorithm>
+#include <map>
+
+#include "ametsuchi/block_query.hpp"
+#include "common/visitor.hpp"
+#include "interfaces/commands/command.hpp"
+
+namespace iroha {
+  namespace synchronizer {
+
+    namespace {
+      using Peers = std::vector<std::shared_ptr<shared_model::interface::Peer>>;
+
+      /**
+       * Add peers which are added by the block to the list
+       */
+      void applyAddPeers(const shared_model::interface::Block &block,
+                         Peers &peers) {
+        for (const auto &tx : block.transactions()) {
+          for (const auto &command : tx.commands()) {
+            visit_in_place(
+                command.get(),
+                [&peers](const shared_model::interface::AddPeer &add_peer) {
+                  peers.push_back(clone(add_peer.peer()));
+                },
+                [](const auto &) {});
+          }
+        }
+      }
+    }  // namespace
+
+    FastSync::FastSync(std::shared_ptr<network::BlockLoader> block_loader,
+                       std::shared_ptr<ametsuchi::Storage> storage,
+                       std::shared_ptr<ametsuchi::PeerQuery> peer_query,
+                       std::shared_ptr<consensus::yac::SupermajorityChecker>
+                           supermajority_checker)
+        : block_loader_(std::move(block_loader)),
+          storage_(std::move(storage)),
+          peer_query_(std::move(peer_query)),
+          supermajority_checker_(std::move(supermajority_checker)),
+          log_(logger::log("FastSync")) {}
+
+    bool FastSync::run() {
+      auto peers = peer_query_->getLedgerPeers();
+      if (not peers) {
+        log_->error("Failed to retrieve peers");
+        return false;
+      }
+
+      std::shared_ptr<shared_model::interface::Block> top_block;
+      storage_->getBlockQuery()->getTopBlock().match(
+          [&top_block](expected::Value<
+                       std::shared_ptr<shared_model::interface::Block>> &block) {
+            top_block = std::move(block.value);
+          },
+          [this](expected::Error<std::string> &error) {
+            log_->error(error.error);
+          });
+      if (not top_block) {
+        return false;
+      }
+
+      // checkpoints with equal digest are signed by different peers
+      std::map<std::string, std::vector<network::Checkpoint>> groups;
+      shared_model::interface::types::HeightType max_height = 0;
+      auto request_checkpoint = [&](const shared_model::interface::Peer &peer) {
+        auto checkpoint = block_loader_->retrieveCheckpoint(peer);
+        if (not checkpoint
+            or checkpoint->snapshot.height <= top_block->height()) {
+          return;
+        }
+        max_height = std::max(max_height, checkpoint->snapshot.height);
+        auto digest = network::checkpointDigest(checkpoint->snapshot,
+                                                checkpoint->block_hash);
+        groups[digest.hex()].push_back(std::move(*checkpoint));
+      };
+      std::vector<shared_model::crypto::PublicKey> pubkeys;
+      for (const auto &peer : *peers) {
+        pubkeys.push_back(peer->pubkey());
+        request_checkpoint(*peer);
+      }
+      if (groups.empty()) {
+        log_->info("No checkpoint ahead of height {}", top_block->height());
+        return false;
+      }
+
+      // blocks are downloaded once up to the highest checkpoint, lower ones
+      // use a prefix of them
+      std::vector<std::shared_ptr<shared_model::interface::Block>> blocks;
+      block_loader_->retrieveBlocks(pubkeys, max_height)
+          .as_blocking()
+          .subscribe([&blocks](const auto &loaded) {
+            blocks.push_back(loaded.block);
+          });
+
+      // hash chain and signatures are checked from the local top block,
+      // peers at each height are remembered to count checkpoint signatures
+      std::map<shared_model::interface::types::HeightType, Peers> peers_at;
+      auto chain_peers = *peers;
+      auto prev_hash = top_block->hash();
+      for (const auto &block : blocks) {
+        if (block->prevHash() != prev_hash
+            or not supermajority_checker_->hasSupermajority(block->signatures(),
+                                                            chain_peers)) {
+          log_->warn("Block {} does not continue the ledger", block->height());
+          break;
+        }
+        applyAddPeers(*block, chain_peers);
+        prev_hash = block->hash();
+        peers_at[block->height()] = chain_peers;
+      }
+
+      // peers added after the local ledger may be the majority of the
+      // network, so their checkpoints are counted as well
+      for (auto it = chain_peers.begin() + peers->size();
+           it != chain_peers.end();
+           ++it) {
+        request_checkpoint(**it);
+      }
+
+      // higher checkpoint is preferred, since less blocks are left to apply
+      std::vector<const std::vector<network::Checkpoint> *> candidates;
+      for (const auto &group : groups) {
+        candidates.push_back(&group.second);
+      }
+      std::sort(candidates.begin(),
+                candidates.end(),
+                [](const auto &lhs, const auto &rhs) {
+                  return lhs->front().snapshot.height
+                      > rhs->front().snapshot.height;
+                });
+
+      for (const auto *candidate : candidates) {
+        const auto &checkpoint = candidate->front();
+        auto height = checkpoint.snapshot.height;
+        auto it = peers_at.find(height);
+        if (it == peers_at.end()) {
+          continue;
+        }
+        auto count = static_cast<size_t>(height - top_block->height());
+        if (blocks[count - 1]->hash() != checkpoint.block_hash) {
+          continue;
+        }
+        const auto &height_peers = it->second;
+        auto signers = std::count_if(
+            candidate->begin(),
+            candidate->end(),
+            [&height_peers](const auto &checkpoint) {
+              return std::any_of(height_peers.begin(),
+                                 height_peers.end(),
+                                 [&checkpoint](const auto &peer) {
+                                   return peer->pubkey() == checkpoint.signer;
+                                 });
+            });
+        if (not supermajority_checker_->checkSize(signers,
+                                                  height_peers.size())) {
+          log_->info("Checkpoint at {} is signed by {} of {} peers",
+                     height,
+                     signers,
+                     height_peers.size());
+          continue;
+        }
+
+        blocks.resize(count);
+        if (storage_->loadSnapshot(checkpoint.snapshot, blocks)) {
+          log_->info("Storage is synchronized to checkpoint at {}", height);
+          return true;
+        }
+        return false;
+      }
+
+      log_->warn("No checkpoint is confirmed by the ledger");
+      return false;
+    }
+
+  }  // namespace synchronizer
+}  // namespace iroha
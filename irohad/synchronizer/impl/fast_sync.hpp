@@ -0,0 +1,63 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_FAST_SYNC_HPP
+#define IROHA_FAST_SYNC_HPP
+
+#include <memory>
+
+#include "ametsuchi/peer_query.hpp"
+#include "ametsuchi/storage.hpp"
+#include "consensus/yac/supermajority_checker.hpp"
+#include "logger/logger.hpp"
+#include "network/block_loader.hpp"
+
+namespace iroha {
+  namespace synchronizer {
+
+    /**
+     * Bootstrap of an empty peer from a checkpoint of other peers instead of
+     * applying every block of the ledger.
+     * Blocks up to the checkpoint are downloaded and their hash chain and
+     * signatures are checked, tracking the peers added on the way. Snapshot
+     * is loaded when its digest is signed by supermajority of the peers at
+     * its height, so checkpoints are requested from the peers of the local
+     * ledger and from the added ones. Blocks after the checkpoint are applied
+     * by synchronizer
+     */
+    class FastSync {
+     public:
+      /**
+       * @param block_loader - loader of blocks and checkpoints
+       * @param storage - storage to load snapshot to
+       * @param peer_query - peers known from the local ledger
+       * @param supermajority_checker - checker of block signatures
+       */
+      FastSync(std::shared_ptr<network::BlockLoader> block_loader,
+               std::shared_ptr<ametsuchi::Storage> storage,
+               std::shared_ptr<ametsuchi::PeerQuery> peer_query,
+               std::shared_ptr<consensus::yac::SupermajorityChecker>
+                   supermajority_checker);
+
+      /**
+       * Load the latest checkpoint which is confirmed by the ledger
+       * @return true if storage was advanced to a checkpoint
+       */
+      bool run();
+
+     private:
+      std::shared_ptr<network::BlockLoader> block_loader_;
+      std::shared_ptr<ametsuchi::Storage> storage_;
+      std::shared_ptr<ametsuchi::PeerQuery> peer_query_;
+      std::shared_ptr<consensus::yac::SupermajorityChecker>
+          supermajority_checker_;
+
+      logger::Logger log_;
+    };
+
+  }  // namespace synchronizer
+}  // namespace iroha
+
+#endif  // IROHA_FAST_SYNC_HPP
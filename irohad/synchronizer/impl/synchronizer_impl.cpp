@@ -15,10 +15,12 @@
  * limitations under the License.
  */
 
+#include <algorithm>
 #include <utility>
 #include "backend/protobuf/block.hpp"
 #include "backend/protobuf/empty_block.hpp"
 #include "interfaces/iroha_internal/block_variant.hpp"
+#include "metrics/round_metrics.hpp"
 
 #include "ametsuchi/mutable_storage.hpp"
 #include "synchronizer/impl/synchronizer_impl.hpp"
@@ -49,6 +51,8 @@ namespace iroha {
     void SynchronizerImpl::process_commit(
         const shared_model::interface::BlockVariant &commit_message_variant) {
       log_->info("processing commit");
+      metrics::PhaseTimer timer(metrics::Phase::kCommit,
+                                commit_message_variant.height());
       auto storageResult = mutableFactory_->createMutableStorage();
       std::unique_ptr<ametsuchi::MutableStorage> storage;
       storageResult.match(
@@ -59,6 +63,7 @@ namespace iroha {
             log_->error(error.error);
           });
       if (not storage) {
+        timer.cancel();
         return;
       }
 
@@ -80,14 +85,19 @@ namespace iroha {
         // Block can be applied to current storage
         // Commit to main Ametsuchi
         mutableFactory_->commit(std::move(storage));
+        timer.stop();
 
         auto single_commit = rxcpp::observable<>::just(commit_message);
 
         notifier_.get_subscriber().on_next(single_commit);
       } else {
         // Block can't be applied to current storage
-        // Download all missing blocks
+        // Download all missing blocks from the peers which signed the commit
+        std::vector<shared_model::crypto::PublicKey> signatories;
         for (const auto &signature : commit_message->signatures()) {
+          signatories.emplace_back(signature.publicKey());
+        }
+        while (not signatories.empty()) {
           auto storageResult = mutableFactory_->createMutableStorage();
           std::unique_ptr<ametsuchi::MutableStorage> storage;
           storageResult.match(
@@ -98,28 +108,54 @@ namespace iroha {
                 log_->error(error.error);
               });
           if (not storage) {
+            timer.cancel();
             return;
           }
-          auto network_chain = blockLoader_->retrieveBlocks(
-              shared_model::crypto::PublicKey(signature.publicKey()));
-          // Check chain last commit
+          // Blocks are applied while the rest of them are still downloaded
+          // and validated, so validator receives the chain directly from
+          // loader. Validation stops at the first rejected block, so the last
+          // received block is the rejected one
           std::vector<std::shared_ptr<shared_model::interface::Block>> blocks;
-          network_chain.as_blocking().subscribe(
-              [&blocks](auto block) { blocks.push_back(block); });
-          auto is_chain_end_expected =
-              blocks.back()->hash() == commit_message->hash();
-          auto chain =
-              rxcpp::observable<>::iterate(blocks, rxcpp::identity_immediate());
+          boost::optional<shared_model::crypto::PublicKey> last_peer;
+          auto network_chain =
+              blockLoader_
+                  ->retrieveBlocks(signatories, commit_message->height())
+                  .map([&blocks,
+                        &last_peer](const network::LoadedBlock &loaded) {
+                    blocks.push_back(loaded.block);
+                    last_peer = loaded.peer;
+                    return loaded.block;
+                  });
+          auto is_chain_valid =
+              validator_->validateChain(network_chain, *storage);
+          // Check chain last commit
+          auto is_chain_end_expected = not blocks.empty()
+              and blocks.back()->hash() == commit_message->hash();
 
-          if (validator_->validateChain(chain, *storage)
-              and is_chain_end_expected) {
-            // Peer send valid chain
+          if (is_chain_valid and is_chain_end_expected) {
+            // Peers sent valid chain
             mutableFactory_->commit(std::move(storage));
+            timer.stop();
+            auto chain = rxcpp::observable<>::iterate(
+                blocks, rxcpp::identity_immediate());
             notifier_.get_subscriber().on_next(chain);
             // You are synchronized
             return;
           }
+          if (is_chain_valid or not last_peer) {
+            // none of the peers has the rest of the chain
+            break;
+          }
+          // peer which sent rejected block is not asked again
+          log_->warn("Peer {} sent invalid block {}, retrying without it",
+                     last_peer->hex(),
+                     blocks.back()->height());
+          signatories.erase(std::remove(signatories.begin(),
+                                        signatories.end(),
+                                        *last_peer),
+                            signatories.end());
         }
+        timer.cancel();
       }
     }
 
@@ -252,7 +252,8 @@ namespace torii {
                     shared_model::interface::StatelessFailedTxResponse,
                     shared_model::interface::StatefulFailedTxResponse,
                     shared_model::interface::CommittedTxResponse,
-                    shared_model::interface::MstExpiredResponse>::value;
+                    shared_model::interface::MstExpiredResponse,
+                    shared_model::interface::OrderingRejectedResponse>::value;
 
   rxcpp::observable<
       std::shared_ptr<shared_model::interface::TransactionResponse>>
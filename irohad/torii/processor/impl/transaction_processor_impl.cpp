@@ -119,6 +119,25 @@ namespace iroha {
             });
       });
 
+      // notify about transactions which ordering service could not accept
+      pcs_->on_rejection().subscribe(
+          [this](const network::OrderingRejection &rejection) {
+            auto error_msg = (boost::format("Ordering service is overloaded, "
+                                            "%d transactions in the queue")
+                              % rejection.queue_size)
+                                 .str();
+            std::lock_guard<std::mutex> lock(notifier_mutex_);
+            for (const auto &hash : rejection.hashes) {
+              log_->info("on ordering rejected: {}", hash.hex());
+              status_bus_->publish(
+                  shared_model::builder::DefaultTransactionStatusBuilder()
+                      .orderingRejected()
+                      .txHash(hash)
+                      .errorMsg(error_msg)
+                      .build());
+            }
+          });
+
       mst_processor_->onPreparedTransactions().subscribe([this](auto &&tx) {
         log_->info("MST tx prepared");
         return this->pcs_->propagate_transaction(tx);
@@ -0,0 +1,108 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_EXPIRING_SET_HPP
+#define IROHA_EXPIRING_SET_HPP
+
+#include <chrono>
+#include <deque>
+#include <unordered_map>
+
+namespace iroha {
+  namespace cache {
+
+    /**
+     * Set which forgets keys after given time since they were inserted or
+     * touched. Not thread-safe
+     * @tparam KeyType type of keys
+     * @tparam KeyHash hasher for keys
+     */
+    template <typename KeyType, typename KeyHash = std::hash<KeyType>>
+    class ExpiringSet {
+     public:
+      using Clock = std::chrono::steady_clock;
+
+      /**
+       * @param window - time for which key is kept
+       */
+      explicit ExpiringSet(Clock::duration window) : window_(window) {}
+
+      /**
+       * Insert key if it is not in the set
+       * @param key - key to be inserted
+       * @param now - current time
+       * @return false if the key is already in the set
+       */
+      bool insert(const KeyType &key, Clock::time_point now = Clock::now()) {
+        expire(now);
+        auto expiry = now + window_;
+        if (not expiry_.emplace(key, expiry).second) {
+          return false;
+        }
+        order_.emplace_back(expiry, key);
+        return true;
+      }
+
+      /**
+       * Keep key for the whole window since now, inserting it if needed
+       * @param key - key to be touched
+       * @param now - current time
+       */
+      void touch(const KeyType &key, Clock::time_point now = Clock::now()) {
+        expire(now);
+        auto expiry = now + window_;
+        expiry_[key] = expiry;
+        order_.emplace_back(expiry, key);
+      }
+
+      /**
+       * @param key - key to be checked
+       * @param now - current time
+       * @return true if the key is in the set
+       */
+      bool contains(const KeyType &key, Clock::time_point now = Clock::now()) {
+        expire(now);
+        return expiry_.count(key) != 0;
+      }
+
+      /**
+       * Forget key before its expiry
+       * @param key - key to be removed
+       */
+      void erase(const KeyType &key) {
+        expiry_.erase(key);
+      }
+
+      /**
+       * @return number of keys in the set
+       */
+      size_t size() const {
+        return expiry_.size();
+      }
+
+     private:
+      /**
+       * Remove keys which were not touched during the window
+       */
+      void expire(Clock::time_point now) {
+        while (not order_.empty() and order_.front().first <= now) {
+          auto it = expiry_.find(order_.front().second);
+          // touched or erased keys leave stale entries in the order
+          if (it != expiry_.end() and it->second == order_.front().first) {
+            expiry_.erase(it);
+          }
+          order_.pop_front();
+        }
+      }
+
+      const Clock::duration window_;
+      std::unordered_map<KeyType, Clock::time_point, KeyHash> expiry_;
+      std::deque<std::pair<Clock::time_point, KeyType>> order_;
+    };
+
+  }  // namespace cache
+}  // namespace iroha
+
+#endif  // IROHA_EXPIRING_SET_HPP
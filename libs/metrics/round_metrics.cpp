@@ -0,0 +1,178 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "metrics/round_metrics.hpp"
+
+#include <algorithm>
+
+#include <rapidjson/stringbuffer.h>
+#include <rapidjson/writer.h>
+
+namespace iroha {
+  namespace metrics {
+
+    const char *phaseName(Phase phase) {
+      static const std::array<const char *, kPhases> names{{"ordering",
+                                                            "validation",
+                                                            "signing",
+                                                            "vote",
+                                                            "propagation",
+                                                            "supermajority",
+                                                            "commit"}};
+      return names.at(static_cast<size_t>(phase));
+    }
+
+    constexpr size_t Histogram::kBuckets;
+
+    void Histogram::add(std::chrono::microseconds duration) {
+      auto us = static_cast<uint64_t>(std::max<int64_t>(duration.count(), 0));
+      size_t bucket = 0;
+      while (bucket + 1 < kBuckets and (us >> bucket) != 0) {
+        ++bucket;
+      }
+      buckets_[bucket].fetch_add(1, std::memory_order_relaxed);
+      count_.fetch_add(1, std::memory_order_relaxed);
+      sum_us_.fetch_add(us, std::memory_order_relaxed);
+      auto max = max_us_.load(std::memory_order_relaxed);
+      while (max < us
+             and not max_us_.compare_exchange_weak(
+                     max, us, std::memory_order_relaxed)) {
+      }
+    }
+
+    Histogram::Snapshot Histogram::snapshot() const {
+      Snapshot snapshot;
+      snapshot.count = count_.load(std::memory_order_relaxed);
+      snapshot.sum_us = sum_us_.load(std::memory_order_relaxed);
+      snapshot.max_us = max_us_.load(std::memory_order_relaxed);
+      for (size_t i = 0; i < kBuckets; ++i) {
+        snapshot.buckets[i] = buckets_[i].load(std::memory_order_relaxed);
+      }
+      return snapshot;
+    }
+
+    constexpr size_t RoundMetrics::kDefaultRetainedRounds;
+
+    RoundMetrics::RoundMetrics(size_t retained_rounds)
+        : retained_rounds_(retained_rounds) {}
+
+    void RoundMetrics::record(Phase phase,
+                              uint64_t height,
+                              std::chrono::microseconds duration) {
+      auto index = static_cast<size_t>(phase);
+      histograms_[index].add(duration);
+
+      std::lock_guard<std::mutex> lock(rounds_mutex_);
+      if (rounds_.size() == retained_rounds_
+          and rounds_.find(height) == rounds_.end()) {
+        // rounds older than the whole window are not recorded
+        if (height < rounds_.begin()->first) {
+          return;
+        }
+        rounds_.erase(rounds_.begin());
+      }
+      rounds_[height][index] += std::max<int64_t>(duration.count(), 0);
+    }
+
+    boost::optional<RoundMetrics::Round> RoundMetrics::round(
+        uint64_t height) const {
+      std::lock_guard<std::mutex> lock(rounds_mutex_);
+      auto it = rounds_.find(height);
+      if (it == rounds_.end()) {
+        return boost::none;
+      }
+      return it->second;
+    }
+
+    Histogram::Snapshot RoundMetrics::histogram(Phase phase) const {
+      return histograms_[static_cast<size_t>(phase)].snapshot();
+    }
+
+    std::string RoundMetrics::toJson() const {
+      rapidjson::StringBuffer buffer;
+      rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+
+      writer.StartObject();
+      writer.Key("phases");
+      writer.StartObject();
+      for (size_t i = 0; i < kPhases; ++i) {
+        auto phase = static_cast<Phase>(i);
+        auto snapshot = histogram(phase);
+        writer.Key(phaseName(phase));
+        writer.StartObject();
+        writer.Key("count");
+        writer.Uint64(snapshot.count);
+        writer.Key("sum_us");
+        writer.Uint64(snapshot.sum_us);
+        writer.Key("max_us");
+        writer.Uint64(snapshot.max_us);
+        // trailing empty buckets are omitted
+        auto last = Histogram::kBuckets;
+        while (last > 0 and snapshot.buckets[last - 1] == 0) {
+          --last;
+        }
+        writer.Key("buckets");
+        writer.StartArray();
+        for (size_t b = 0; b < last; ++b) {
+          writer.Uint64(snapshot.buckets[b]);
+        }
+        writer.EndArray();
+        writer.EndObject();
+      }
+      writer.EndObject();
+
+      writer.Key("rounds");
+      writer.StartArray();
+      {
+        std::lock_guard<std::mutex> lock(rounds_mutex_);
+        for (const auto &round : rounds_) {
+          writer.StartObject();
+          writer.Key("height");
+          writer.Uint64(round.first);
+          for (size_t i = 0; i < kPhases; ++i) {
+            writer.Key(phaseName(static_cast<Phase>(i)));
+            writer.Uint64(round.second[i]);
+          }
+          writer.EndObject();
+        }
+      }
+      writer.EndArray();
+      writer.EndObject();
+
+      return buffer.GetString();
+    }
+
+    RoundMetrics &roundMetrics() {
+      static RoundMetrics metrics;
+      return metrics;
+    }
+
+    PhaseTimer::PhaseTimer(Phase phase, uint64_t height)
+        : phase_(phase),
+          height_(height),
+          start_(std::chrono::steady_clock::now()) {}
+
+    PhaseTimer::~PhaseTimer() {
+      stop();
+    }
+
+    void PhaseTimer::stop() {
+      if (stopped_) {
+        return;
+      }
+      stopped_ = true;
+      roundMetrics().record(
+          phase_,
+          height_,
+          std::chrono::duration_cast<std::chrono::microseconds>(
+              std::chrono::steady_clock::now() - start_));
+    }
+
+    void PhaseTimer::cancel() {
+      stopped_ = true;
+    }
+
+  }  // namespace metrics
+}  // namespace iroha
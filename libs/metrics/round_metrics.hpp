@@ -0,0 +1,161 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_ROUND_METRICS_HPP
+#define IROHA_ROUND_METRICS_HPP
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <string>
+
+#include <boost/optional.hpp>
+
+namespace iroha {
+  namespace metrics {
+
+    /**
+     * Phases of consensus round
+     */
+    enum class Phase : size_t {
+      /// from commit of previous block until proposal is passed to pipeline
+      kOrdering,
+      /// stateful validation of proposal
+      kValidation,
+      /// signing of block
+      kSigning,
+      /// hashing and ordering of peers before vote
+      kVote,
+      /// sending of vote to peers
+      kPropagation,
+      /// from own vote until commit of the round is received
+      kSupermajority,
+      /// apply and commit of block to storage
+      kCommit,
+      kCount
+    };
+
+    /// number of phases in a round
+    constexpr size_t kPhases = static_cast<size_t>(Phase::kCount);
+
+    /**
+     * @return name of phase used in dumps
+     */
+    const char *phaseName(Phase phase);
+
+    /**
+     * Lock-free histogram of durations with power of two buckets
+     */
+    class Histogram {
+     public:
+      /// bucket i counts durations in [2^(i-1), 2^i) microseconds
+      static constexpr size_t kBuckets = 32;
+
+      struct Snapshot {
+        uint64_t count = 0;
+        uint64_t sum_us = 0;
+        uint64_t max_us = 0;
+        std::array<uint64_t, kBuckets> buckets{};
+      };
+
+      void add(std::chrono::microseconds duration);
+
+      Snapshot snapshot() const;
+
+     private:
+      std::atomic<uint64_t> count_{0};
+      std::atomic<uint64_t> sum_us_{0};
+      std::atomic<uint64_t> max_us_{0};
+      std::array<std::atomic<uint64_t>, kBuckets> buckets_{};
+    };
+
+    /**
+     * Durations of round phases aggregated into histograms, and kept per
+     * height for a window of recent rounds
+     */
+    class RoundMetrics {
+     public:
+      /// durations of phases of one round in microseconds
+      using Round = std::array<uint64_t, kPhases>;
+
+      static constexpr size_t kDefaultRetainedRounds = 128;
+
+      explicit RoundMetrics(size_t retained_rounds = kDefaultRetainedRounds);
+
+      /**
+       * Add duration of phase, durations of repeated phase of the same round
+       * are summed up
+       * @param phase - finished phase
+       * @param height - height of block of the round
+       * @param duration - time spent in the phase
+       */
+      void record(Phase phase,
+                  uint64_t height,
+                  std::chrono::microseconds duration);
+
+      /**
+       * @param height - height of block of the round
+       * @return durations of phases if round is retained
+       */
+      boost::optional<Round> round(uint64_t height) const;
+
+      /**
+       * @return aggregated durations of phase
+       */
+      Histogram::Snapshot histogram(Phase phase) const;
+
+      /**
+       * @return histograms and retained rounds as JSON object
+       */
+      std::string toJson() const;
+
+     private:
+      const size_t retained_rounds_;
+      std::array<Histogram, kPhases> histograms_;
+      mutable std::mutex rounds_mutex_;
+      std::map<uint64_t, Round> rounds_;
+    };
+
+    /**
+     * @return metrics of rounds of this process
+     */
+    RoundMetrics &roundMetrics();
+
+    /**
+     * Records time from construction to destruction or to stop call as
+     * duration of phase, unless the timer is cancelled
+     */
+    class PhaseTimer {
+     public:
+      PhaseTimer(Phase phase, uint64_t height);
+
+      ~PhaseTimer();
+
+      /**
+       * Record duration of phase now, does nothing if already stopped
+       */
+      void stop();
+
+      /**
+       * Discard the phase, so that its duration is not recorded
+       */
+      void cancel();
+
+      PhaseTimer(const PhaseTimer &) = delete;
+      PhaseTimer &operator=(const PhaseTimer &) = delete;
+
+     private:
+      Phase phase_;
+      uint64_t height_;
+      std::chrono::steady_clock::time_point start_;
+      bool stopped_ = false;
+    };
+
+  }  // namespace metrics
+}  // namespace iroha
+
+#endif  // IROHA_ROUND_METRICS_HPP
@@ -0,0 +1,105 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_RX_TIMER_HPP
+#define IROHA_RX_TIMER_HPP
+
+#include <rxcpp/rx.hpp>
+
+#include "timer/timer_wheel.hpp"
+
+namespace iroha {
+  namespace timer {
+
+    namespace detail {
+      /**
+       * Periodic emission which reschedules itself on the wheel.
+       * Wheel is not owned, since scheduled callback owns the interval: it is
+       * alive while its own thread invokes the callback, and the first
+       * schedule is made by the subscription which owns the wheel
+       */
+      class Interval : public std::enable_shared_from_this<Interval> {
+       public:
+        Interval(TimerWheel &wheel,
+                 std::chrono::milliseconds period,
+                 rxcpp::subscriber<long> subscriber)
+            : wheel_(wheel),
+              period_(period),
+              subscriber_(std::move(subscriber)) {}
+
+        void start() {
+          scheduleNext(0);
+        }
+
+        void stop() {
+          std::lock_guard<std::mutex> lock(mutex_);
+          stopped_ = true;
+          handle_.cancel();
+        }
+
+       private:
+        void scheduleNext(long value) {
+          std::lock_guard<std::mutex> lock(mutex_);
+          if (stopped_) {
+            return;
+          }
+          handle_ = wheel_.schedule(
+              period_, [self = shared_from_this(), value] {
+                if (self->subscriber_.is_subscribed()) {
+                  self->subscriber_.on_next(value);
+                  self->scheduleNext(value + 1);
+                }
+              });
+        }
+
+        TimerWheel &wheel_;
+        std::chrono::milliseconds period_;
+        rxcpp::subscriber<long> subscriber_;
+        std::mutex mutex_;
+        bool stopped_ = false;
+        TimerHandle handle_;
+      };
+    }  // namespace detail
+
+    /**
+     * Create observable which emits single value after delay and completes.
+     * Value is emitted on the wheel thread, unsubscription cancels the timer
+     * @param wheel - wheel which invokes the timer
+     * @param delay - time before emission
+     * @return cold observable, every subscription starts its own timer
+     */
+    inline rxcpp::observable<long> makeTimer(
+        std::shared_ptr<TimerWheel> wheel, std::chrono::milliseconds delay) {
+      return rxcpp::observable<>::create<long>(
+          [wheel = std::move(wheel), delay](rxcpp::subscriber<long> s) {
+            auto handle = wheel->schedule(delay, [s] {
+              s.on_next(0);
+              s.on_completed();
+            });
+            s.add([handle] { handle.cancel(); });
+          });
+    }
+
+    /**
+     * Create observable which emits increasing values with given period.
+     * Values are emitted on the wheel thread, unsubscription stops emission
+     * @param wheel - wheel which invokes the timer
+     * @param period - time between emissions
+     * @return cold observable, every subscription starts its own interval
+     */
+    inline rxcpp::observable<long> makeInterval(
+        std::shared_ptr<TimerWheel> wheel, std::chrono::milliseconds period) {
+      return rxcpp::observable<>::create<long>(
+          [wheel = std::move(wheel), period](rxcpp::subscriber<long> s) {
+            auto interval = std::make_shared<detail::Interval>(*wheel, period, s);
+            s.add([interval] { interval->stop(); });
+            interval->start();
+          });
+    }
+
+  }  // namespace timer
+}  // namespace iroha
+
+#endif  // IROHA_RX_TIMER_HPP
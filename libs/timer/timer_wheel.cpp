@@ -0,0 +1,151 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "timer/timer_wheel.hpp"
+
+#include <algorithm>
+#include <iterator>
+
+namespace iroha {
+  namespace timer {
+
+    TimerHandle::TimerHandle(std::shared_ptr<std::atomic<bool>> cancelled)
+        : cancelled_(std::move(cancelled)) {}
+
+    void TimerHandle::cancel() const {
+      if (cancelled_) {
+        *cancelled_ = true;
+      }
+    }
+
+    constexpr size_t TimerWheel::kSlotBits;
+    constexpr size_t TimerWheel::kSlots;
+    constexpr size_t TimerWheel::kLevels;
+
+    TimerWheel::TimerWheel()
+        : start_(Clock::now()), thread_(&TimerWheel::run, this) {}
+
+    TimerWheel::~TimerWheel() {
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+      }
+      cv_.notify_one();
+      thread_.join();
+    }
+
+    TimerHandle TimerWheel::schedule(std::chrono::milliseconds delay,
+                                     Callback callback) {
+      auto cancelled = std::make_shared<std::atomic<bool>>(false);
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto current = now();
+        if (entries_ == 0) {
+          // wheel is empty, so it can be moved to current time at once
+          current_tick_ = std::max(current_tick_, current);
+        }
+        // current tick has already partially passed, so one more tick is
+        // added in order not to invoke the callback earlier than requested
+        auto expiry = std::max<uint64_t>(
+            current + std::max<int64_t>(delay.count(), 0) + 1,
+            current_tick_ + 1);
+        insert({expiry, std::move(callback), cancelled});
+        ++entries_;
+      }
+      cv_.notify_one();
+      return TimerHandle(std::move(cancelled));
+    }
+
+    void TimerWheel::insert(Entry entry) {
+      // expiry too far in the future is placed to the last slot of the
+      // highest level and reinserted when the slot is cascaded
+      const auto max_delta = (uint64_t{1} << (kSlotBits * kLevels)) - 1;
+      auto expiry = std::min(std::max(entry.expiry, current_tick_),
+                             current_tick_ + max_delta);
+      auto delta = expiry - current_tick_;
+
+      size_t level = 0;
+      while (level + 1 < kLevels
+             and delta >= (uint64_t{1} << (kSlotBits * (level + 1)))) {
+        ++level;
+      }
+      auto slot = (expiry >> (kSlotBits * level)) & (kSlots - 1);
+      wheels_[level][slot].push_back(std::move(entry));
+    }
+
+    void TimerWheel::cascade(size_t level) {
+      auto slot_index = (current_tick_ >> (kSlotBits * level)) & (kSlots - 1);
+      Slot slot;
+      slot.swap(wheels_[level][slot_index]);
+      for (auto &entry : slot) {
+        if (*entry.cancelled) {
+          --entries_;
+        } else {
+          insert(std::move(entry));
+        }
+      }
+    }
+
+    void TimerWheel::tick(Slot &expired) {
+      ++current_tick_;
+      for (size_t level = 1; level < kLevels; ++level) {
+        auto lower_bits = (uint64_t{1} << (kSlotBits * level)) - 1;
+        if ((current_tick_ & lower_bits) != 0) {
+          break;
+        }
+        cascade(level);
+      }
+
+      auto &slot = wheels_[0][current_tick_ & (kSlots - 1)];
+      entries_ -= slot.size();
+      std::move(std::begin(slot), std::end(slot), std::back_inserter(expired));
+      slot.clear();
+    }
+
+    uint64_t TimerWheel::now() const {
+      return std::chrono::duration_cast<std::chrono::milliseconds>(
+                 Clock::now() - start_)
+          .count();
+    }
+
+    void TimerWheel::run() {
+      std::unique_lock<std::mutex> lock(mutex_);
+      while (not stop_) {
+        Slot expired;
+        auto current = now();
+        while (current_tick_ < current) {
+          tick(expired);
+        }
+
+        if (not expired.empty()) {
+          lock.unlock();
+          for (auto &entry : expired) {
+            // flag is set so cancel after invocation does nothing
+            if (not entry.cancelled->exchange(true)) {
+              entry.callback();
+            }
+          }
+          lock.lock();
+          continue;
+        }
+
+        if (entries_ == 0) {
+          cv_.wait(lock, [this] { return stop_ or entries_ != 0; });
+          continue;
+        }
+
+        // sleep until the nearest non-empty slot of the lowest level or
+        // until the next cascade
+        auto next = current_tick_ + 1;
+        while ((next & (kSlots - 1)) != 0
+               and wheels_[0][next & (kSlots - 1)].empty()) {
+          ++next;
+        }
+        cv_.wait_until(lock, start_ + std::chrono::milliseconds(next));
+      }
+    }
+
+  }  // namespace timer
+}  // namespace iroha
@@ -0,0 +1,122 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_TIMER_WHEEL_HPP
+#define IROHA_TIMER_WHEEL_HPP
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace iroha {
+  namespace timer {
+
+    /**
+     * Handle of scheduled callback, allows to cancel it.
+     * Default constructed handle refers to nothing
+     */
+    class TimerHandle {
+     public:
+      TimerHandle() = default;
+
+      explicit TimerHandle(std::shared_ptr<std::atomic<bool>> cancelled);
+
+      /**
+       * Prevent callback from being invoked, does nothing if callback was
+       * already invoked
+       */
+      void cancel() const;
+
+     private:
+      std::shared_ptr<std::atomic<bool>> cancelled_;
+    };
+
+    /**
+     * Hierarchical timer wheel with millisecond resolution.
+     * Scheduling and cancelling are O(1), callbacks are invoked on the single
+     * thread of the wheel, so they should not block for long
+     */
+    class TimerWheel {
+     public:
+      using Clock = std::chrono::steady_clock;
+      using Callback = std::function<void()>;
+
+      TimerWheel();
+
+      ~TimerWheel();
+
+      TimerWheel(const TimerWheel &) = delete;
+      TimerWheel &operator=(const TimerWheel &) = delete;
+
+      /**
+       * Invoke callback after given delay
+       * @param delay - time after which callback is invoked
+       * @param callback - function to be invoked
+       * @return handle to cancel the callback
+       */
+      TimerHandle schedule(std::chrono::milliseconds delay, Callback callback);
+
+     private:
+      /// number of slots on each level of the wheel
+      static constexpr size_t kSlotBits = 6;
+      static constexpr size_t kSlots = 1 << kSlotBits;
+      /// levels cover 64 ms, 4 s, 4.4 min and 4.6 h
+      static constexpr size_t kLevels = 4;
+
+      struct Entry {
+        uint64_t expiry;
+        Callback callback;
+        std::shared_ptr<std::atomic<bool>> cancelled;
+      };
+
+      using Slot = std::vector<Entry>;
+
+      /**
+       * Place entry into the slot which corresponds to its expiry
+       */
+      void insert(Entry entry);
+
+      /**
+       * Move entries of current slot of given level to lower levels
+       */
+      void cascade(size_t level);
+
+      /**
+       * Advance wheel by one tick
+       * @param expired - entries which expired on this tick
+       */
+      void tick(Slot &expired);
+
+      /**
+       * @return number of ticks passed since the wheel was started
+       */
+      uint64_t now() const;
+
+      /**
+       * Loop of the wheel thread
+       */
+      void run();
+
+      const Clock::time_point start_;
+      uint64_t current_tick_ = 0;
+      size_t entries_ = 0;
+      std::array<std::array<Slot, kSlots>, kLevels> wheels_;
+
+      bool stop_ = false;
+      std::mutex mutex_;
+      std::condition_variable cv_;
+      std::thread thread_;
+    };
+
+  }  // namespace timer
+}  // namespace iroha
+
+#endif  // IROHA_TIMER_WHEEL_HPP
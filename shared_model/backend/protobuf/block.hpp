@@ -65,32 +65,29 @@ namespace shared_model {
       template <typename T>
       using Lazy = detail::LazyInitializer<T>;
 
-      iroha::protocol::Block::Payload &payload_{*proto_.mutable_payload()};
-
       Lazy<std::vector<proto::Transaction>> transactions_{[this] {
         return std::vector<proto::Transaction>(
-            payload_.mutable_transactions()->begin(),
-            payload_.mutable_transactions()->end());
+            proto_->mutable_payload()->mutable_transactions()->begin(),
+            proto_->mutable_payload()->mutable_transactions()->end());
       }};
 
       Lazy<interface::types::BlobType> blob_{
-          [this] { return makeBlob(proto_); }};
+          [this] { return makeBlob(*proto_); }};
 
       Lazy<interface::types::HashType> prev_hash_{[this] {
-        return interface::types::HashType(proto_.payload().prev_block_hash());
+        return interface::types::HashType(proto_->payload().prev_block_hash());
       }};
 
       Lazy<SignatureSetType<proto::Signature>> signatures_{[this] {
-        auto signatures = proto_.signatures()
-            | boost::adaptors::transformed([](const auto &x) {
-                            return proto::Signature(x);
-                          });
+        auto signatures = *proto_->mutable_signatures()
+            | boost::adaptors::transformed(
+                              [](auto &x) { return proto::Signature(x); });
         return SignatureSetType<proto::Signature>(signatures.begin(),
                                                   signatures.end());
       }};
 
       Lazy<interface::types::BlobType> payload_blob_{
-          [this] { return makeBlob(payload_); }};
+          [this] { return makeBlob(proto_->payload()); }};
     };
   }  // namespace proto
 }  // namespace shared_model
@@ -6,8 +6,15 @@
 #ifndef IROHA_NONCOPYABLE_PROTO_HPP
 #define IROHA_NONCOPYABLE_PROTO_HPP
 
+#include <memory>
+#include <type_traits>
+
+#include <google/protobuf/arena.h>
+
 /**
  * Generic class for handling proto objects which are not intended to be copied.
+ * Transport is either owned by the object or allocated in a protobuf arena,
+ * which is shared by all objects built from it.
  * @tparam Iface is interface to inherit from
  * @tparam Proto is protobuf container
  * @tparam Impl is implementation of Iface
@@ -20,22 +27,60 @@ class NonCopyableProto : public Iface {
   /*
    * Construct object from transport. Transport can be moved or copied.
    */
-  template <typename Transport>
-  NonCopyableProto(Transport &&ref) : proto_(std::forward<Transport>(ref)){}
+  template <typename Transport,
+            typename = std::enable_if_t<not std::is_base_of<
+                NonCopyableProto,
+                std::decay_t<Transport>>::value>>
+  NonCopyableProto(Transport &&ref)
+      : transport_(std::forward<Transport>(ref)), proto_(&transport_) {}
+
+  /*
+   * Construct object from transport allocated in the arena. Transport with
+   * all its sub-messages is released together with the arena, when the last
+   * object sharing it is destroyed.
+   */
+  NonCopyableProto(std::shared_ptr<google::protobuf::Arena> arena,
+                   Proto &transport)
+      : arena_(std::move(arena)), proto_(&transport) {}
 
   NonCopyableProto(const NonCopyableProto &o) = delete;
   NonCopyableProto &operator=(const NonCopyableProto &o) = delete;
 
   const Proto &getTransport() const {
-    return proto_;
+    return *proto_;
   }
 
  protected:
+  NonCopyableProto(NonCopyableProto &&o) noexcept : proto_(&transport_) {
+    takeTransport(std::move(o));
+  }
+
+  /*
+   * Take transport of another object: transport allocated in an arena is
+   * passed without copying, owned transport is moved.
+   */
+  void takeTransport(NonCopyableProto &&o) noexcept {
+    if (o.arena_) {
+      proto_ = o.proto_;
+      transport_.Clear();
+    } else {
+      transport_ = std::move(o.transport_);
+      proto_ = &transport_;
+    }
+    arena_ = std::move(o.arena_);
+    o.proto_ = &o.transport_;
+  }
+
   typename Iface::ModelType *clone() const override final {
-    return new Impl(proto_);
+    return new Impl(*proto_);
   }
 
-  Proto proto_;
+ private:
+  std::shared_ptr<google::protobuf::Arena> arena_;
+  Proto transport_;
+
+ protected:
+  Proto *proto_;
 };
 
 #endif  // IROHA_NONCOPYABLE_PROTO_HPP
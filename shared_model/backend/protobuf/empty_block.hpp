@@ -91,7 +91,7 @@ namespace shared_model {
 
       const Lazy<SignatureSetType<proto::Signature>> signatures_{[this] {
         SignatureSetType<proto::Signature> sigs;
-        for (const auto &sig : proto_->signatures()) {
+        for (auto &sig : *proto_->mutable_signatures()) {
           sigs.emplace(sig);
         }
         return sigs;
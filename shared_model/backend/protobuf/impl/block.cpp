@@ -7,11 +7,10 @@
 
 namespace shared_model {
   namespace proto {
-    Block::Block(Block &&o) noexcept : NonCopyableProto(std::move(o.proto_)) {}
+    Block::Block(Block &&o) noexcept : NonCopyableProto(std::move(o)) {}
 
     Block &Block::operator=(Block &&o) noexcept {
-      proto_ = std::move(o.proto_);
-      payload_ = *proto_.mutable_payload();
+      takeTransport(std::move(o));
 
       transactions_.invalidate();
       blob_.invalidate();
@@ -27,7 +26,7 @@ namespace shared_model {
     }
 
     interface::types::HeightType Block::height() const {
-      return payload_.height();
+      return proto_->payload().height();
     }
 
     const interface::types::HashType &Block::prevHash() const {
@@ -57,7 +56,7 @@ namespace shared_model {
         return false;
       }
 
-      auto sig = proto_.add_signatures();
+      auto sig = proto_->add_signatures();
       sig->set_signature(crypto::toBinaryString(signed_blob));
       sig->set_pubkey(crypto::toBinaryString(public_key));
 
@@ -66,11 +65,11 @@ namespace shared_model {
     }
 
     interface::types::TimestampType Block::createdTime() const {
-      return payload_.created_time();
+      return proto_->payload().created_time();
     }
 
     interface::types::TransactionsNumberType Block::txsNumber() const {
-      return payload_.tx_number();
+      return proto_->payload().tx_number();
     }
 
     const interface::types::BlobType &Block::payload() const {
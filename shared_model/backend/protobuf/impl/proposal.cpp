@@ -10,10 +10,10 @@ namespace shared_model {
     using namespace interface::types;
 
     Proposal::Proposal(Proposal &&o) noexcept
-        : NonCopyableProto(std::move(o.proto_)) {}
+        : NonCopyableProto(std::move(o)) {}
 
     Proposal &Proposal::operator=(Proposal &&o) noexcept {
-      proto_ = std::move(o.proto_);
+      takeTransport(std::move(o));
       transactions_.invalidate();
 
       return *this;
@@ -24,11 +24,11 @@ namespace shared_model {
     }
 
     TimestampType Proposal::createdTime() const {
-      return proto_.created_time();
+      return proto_->created_time();
     }
 
     HeightType Proposal::height() const {
-      return proto_.height();
+      return proto_->height();
     }
 
   }  // namespace proto
@@ -39,8 +39,8 @@ namespace shared_model {
 
       const Lazy<std::vector<proto::Transaction>> transactions_{[this] {
         return std::vector<proto::Transaction>(
-            proto_.mutable_transactions()->begin(),
-            proto_.mutable_transactions()->end());
+            proto_->mutable_transactions()->begin(),
+            proto_->mutable_transactions()->end());
       }};
     };
   }  // namespace proto
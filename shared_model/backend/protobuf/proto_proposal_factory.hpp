@@ -22,7 +22,7 @@ namespace shared_model {
           interface::types::TimestampType created_time,
           const interface::types::TransactionsCollectionType &transactions)
           override {
-        return createProposal(
+        return validate(
             createProtoProposal(height, created_time, transactions));
       }
 
@@ -31,8 +31,7 @@ namespace shared_model {
           interface::types::TimestampType created_time,
           const interface::types::TransactionsCollectionType &transactions)
           override {
-        return std::make_unique<Proposal>(
-            createProtoProposal(height, created_time, transactions));
+        return createProtoProposal(height, created_time, transactions);
       }
 
       /**
@@ -40,26 +39,40 @@ namespace shared_model {
        */
       FactoryResult<std::unique_ptr<interface::Proposal>> createProposal(
           const iroha::protocol::Proposal &proposal) {
-        return validate(std::make_unique<Proposal>(proposal));
+        return validate(makeProposal([&proposal](auto &transport) {
+          transport.CopyFrom(proposal);
+        }));
       }
 
      private:
-      iroha::protocol::Proposal createProtoProposal(
+      /**
+       * Create proposal which transport is allocated in its own arena
+       * @param fill - function filling the transport
+       */
+      template <typename Fill>
+      std::unique_ptr<Proposal> makeProposal(Fill &&fill) {
+        auto arena = std::make_shared<google::protobuf::Arena>();
+        auto transport =
+            google::protobuf::Arena::CreateMessage<iroha::protocol::Proposal>(
+                arena.get());
+        fill(*transport);
+        return std::make_unique<Proposal>(std::move(arena), *transport);
+      }
+
+      std::unique_ptr<Proposal> createProtoProposal(
           interface::types::HeightType height,
           interface::types::TimestampType created_time,
           const interface::types::TransactionsCollectionType &transactions) {
-        iroha::protocol::Proposal proposal;
-
-        proposal.set_height(height);
-        proposal.set_created_time(created_time);
-
-        for (const auto &tx : transactions) {
-          *proposal.add_transactions() =
-              static_cast<const shared_model::proto::Transaction &>(tx)
-                  .getTransport();
-        }
+        return makeProposal([&](auto &proposal) {
+          proposal.set_height(height);
+          proposal.set_created_time(created_time);
 
-        return proposal;
+          for (const auto &tx : transactions) {
+            proposal.add_transactions()->CopyFrom(
+                static_cast<const shared_model::proto::Transaction &>(tx)
+                    .getTransport());
+          }
+        });
       }
 
       FactoryResult<std::unique_ptr<interface::Proposal>> validate(
@@ -31,7 +31,7 @@ namespace shared_model {
           signatures_{[this] {
             SignatureSetType<proto::Signature> set;
             if (proto_->has_signature()) {
-              set.emplace(proto_->signature());
+              set.emplace(*proto_->mutable_signature());
             }
             return set;
           }} {}
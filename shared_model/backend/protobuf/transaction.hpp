@@ -37,10 +37,14 @@ namespace shared_model {
       explicit Transaction(TransactionType &&transaction)
           : CopyableProto(std::forward<TransactionType>(transaction)) {}
 
-      Transaction(const Transaction &o) : Transaction(o.proto_) {}
+      Transaction(const Transaction &o) : Transaction(o.proto_) {
+        copyHashes(o);
+      }
 
       Transaction(Transaction &&o) noexcept
-          : Transaction(std::move(o.proto_)) {}
+          : Transaction(std::move(o.proto_)) {
+        copyHashes(o);
+      }
 
       const interface::types::AccountIdType &creatorAccountId() const override {
         return reduced_payload_.creator_account_id();
@@ -107,12 +111,21 @@ namespace shared_model {
       const iroha::protocol::Transaction::Payload &payload_{proto_->payload()};
 
       const iroha::protocol::Transaction::Payload::ReducedPayload
-          reduced_payload_{proto_->payload().reduced_payload()};
-
-      const Lazy<std::vector<proto::Command>> commands_{[this] {
-        return std::vector<proto::Command>(reduced_payload_.commands().begin(),
-                                           reduced_payload_.commands().end());
-      }};
+          &reduced_payload_{proto_->payload().reduced_payload()};
+
+      // wrappers are built over mutable fields in order to hold references:
+      // construction from const messages copies each of them
+      const Lazy<std::vector<proto::Command>> commands_{
+          [this]() -> std::vector<proto::Command> {
+            if (not payload_.has_reduced_payload()) {
+              return {};
+            }
+            auto &commands = *proto_->mutable_payload()
+                                  ->mutable_reduced_payload()
+                                  ->mutable_commands();
+            return std::vector<proto::Command>(commands.begin(),
+                                               commands.end());
+          }};
 
       const Lazy<interface::types::BlobType> blob_{
           [this] { return makeBlob(*proto_); }};
@@ -134,10 +147,9 @@ namespace shared_model {
           }};
 
       const Lazy<SignatureSetType<proto::Signature>> signatures_{[this] {
-        auto signatures = proto_->signatures()
-            | boost::adaptors::transformed([](const auto &x) {
-                            return proto::Signature(x);
-                          });
+        auto signatures = *proto_->mutable_signatures()
+            | boost::adaptors::transformed(
+                              [](auto &x) { return proto::Signature(x); });
         return SignatureSetType<proto::Signature>(signatures.begin(),
                                                   signatures.end());
       }};
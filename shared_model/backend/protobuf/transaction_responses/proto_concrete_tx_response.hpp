@@ -32,6 +32,9 @@ namespace shared_model {
                                              iroha::protocol::ToriiResponse>;
     using MstExpiredResponse = TrivialProto<interface::MstExpiredResponse,
                                             iroha::protocol::ToriiResponse>;
+    using OrderingRejectedResponse =
+        TrivialProto<interface::OrderingRejectedResponse,
+                     iroha::protocol::ToriiResponse>;
     using NotReceivedTxResponse = TrivialProto<interface::NotReceivedTxResponse,
                                                iroha::protocol::ToriiResponse>;
   }  // namespace proto
@@ -40,6 +40,7 @@ namespace shared_model {
                                                       StatefulValidTxResponse,
                                                       CommittedTxResponse,
                                                       MstExpiredResponse,
+                                                      OrderingRejectedResponse,
                                                       NotReceivedTxResponse>;
 
       /// Type with list of types in ResponseVariantType
@@ -86,8 +86,8 @@ namespace shared_model {
       auto transactions(const T &transactions) const {
         return transform<Transactions>([&](auto &block) {
           for (const auto &tx : transactions) {
-            new (block.mutable_payload()->add_transactions())
-                iroha::protocol::Transaction(tx.getTransport());
+            block.mutable_payload()->add_transactions()->CopyFrom(
+                tx.getTransport());
           }
         });
       }
@@ -116,7 +116,13 @@ namespace shared_model {
         auto tx_number = block_.payload().transactions().size();
         block_.mutable_payload()->set_tx_number(tx_number);
 
-        auto result = Block(iroha::protocol::Block(block_));
+        // built block owns an arena, so its transport is allocated at once
+        auto arena = std::make_shared<google::protobuf::Arena>();
+        auto transport =
+            google::protobuf::Arena::CreateMessage<iroha::protocol::Block>(
+                arena.get());
+        transport->CopyFrom(block_);
+        auto result = Block(std::move(arena), *transport);
         auto answer = stateless_validator_.validate(result);
 
         if (answer.hasErrors()) {
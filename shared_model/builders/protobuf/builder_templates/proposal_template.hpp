@@ -78,8 +78,7 @@ namespace shared_model {
       auto transactions(const T &transactions) const {
         return transform<Transactions>([&](auto &proposal) {
           for (const auto &tx : transactions) {
-            new (proposal.add_transactions())
-                iroha::protocol::Transaction(tx.getTransport());
+            proposal.add_transactions()->CopyFrom(tx.getTransport());
           }
         });
       }
@@ -92,7 +91,13 @@ namespace shared_model {
 
       Proposal build() {
         static_assert(S == (1 << TOTAL) - 1, "Required fields are not set");
-        auto result = Proposal(iroha::protocol::Proposal(proposal_));
+        // built proposal owns an arena, so its transport is allocated at once
+        auto arena = std::make_shared<google::protobuf::Arena>();
+        auto transport =
+            google::protobuf::Arena::CreateMessage<iroha::protocol::Proposal>(
+                arena.get());
+        transport->CopyFrom(proposal_);
+        auto result = Proposal(std::move(arena), *transport);
         auto answer = stateless_validator_.validate(result);
         if (answer.hasErrors()) {
           throw std::invalid_argument(answer.reason());
@@ -81,6 +81,13 @@ namespace shared_model {
       return copy;
     }
 
+    TransactionStatusBuilder TransactionStatusBuilder::orderingRejected() {
+      TransactionStatusBuilder copy(*this);
+      copy.tx_response_.set_tx_status(
+          iroha::protocol::TxStatus::ORDERING_REJECTED);
+      return copy;
+    }
+
     TransactionStatusBuilder TransactionStatusBuilder::txHash(
         const crypto::Hash &hash) {
       TransactionStatusBuilder copy(*this);
@@ -42,6 +42,8 @@ namespace shared_model {
 
       TransactionStatusBuilder mstExpired();
 
+      TransactionStatusBuilder orderingRejected();
+
       TransactionStatusBuilder txHash(const crypto::Hash &hash);
 
       TransactionStatusBuilder errorMsg(const std::string &msg);
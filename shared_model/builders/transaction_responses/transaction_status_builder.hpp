@@ -79,6 +79,12 @@ namespace shared_model {
         return copy;
       }
 
+      TransactionStatusBuilder orderingRejected() {
+        TransactionStatusBuilder copy(*this);
+        copy.builder_ = this->builder_.orderingRejected();
+        return copy;
+      }
+
       TransactionStatusBuilder txHash(const crypto::Hash &hash) {
         TransactionStatusBuilder copy(*this);
         copy.builder_ = this->builder_.txHash(hash);
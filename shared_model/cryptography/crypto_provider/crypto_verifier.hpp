@@ -18,15 +18,14 @@
 #ifndef IROHA_CRYPTO_VERIFIER_HPP
 #define IROHA_CRYPTO_VERIFIER_HPP
 
+#include <algorithm>
+
 #include "cryptography/crypto_provider/crypto_defaults.hpp"
+#include "cryptography/verification_batch.hpp"
 
 namespace shared_model {
   namespace crypto {
 
-    class Signed;
-    class Blob;
-    class PublicKey;
-
     /**
      * CryptoVerifier - adapter for generalization verification of cryptographic
      * signatures
@@ -48,6 +47,27 @@ namespace shared_model {
         return Algorithm::verify(signedData, source, pubKey);
       }
 
+      /**
+       * Verify a batch of signatures in one call
+       * @param batch - signatures with sources and public keys of signatories
+       * @return vector of results, true for every correct signature
+       */
+      static VerificationResults verifyBatch(const VerificationBatch &batch) {
+        return Algorithm::verifyBatch(batch);
+      }
+
+      /**
+       * Check that every signature of the batch is correct
+       * @param batch - signatures with sources and public keys of signatories
+       * @return true if all signatures are correct
+       */
+      static bool verifyAll(const VerificationBatch &batch) {
+        auto results = verifyBatch(batch);
+        return std::all_of(results.begin(), results.end(), [](bool result) {
+          return result;
+        });
+      }
+
       /// close constructor for forbidding instantiation
       CryptoVerifier() = delete;
     };
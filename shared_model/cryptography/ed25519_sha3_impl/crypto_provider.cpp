@@ -34,6 +34,11 @@ namespace shared_model {
       return Verifier::verify(signedData, orig, publicKey);
     }
 
+    VerificationResults CryptoProviderEd25519Sha3::verifyBatch(
+        const VerificationBatch &batch) {
+      return Verifier::verifyBatch(batch);
+    }
+
     Seed CryptoProviderEd25519Sha3::generateSeed() {
       return Seed(iroha::create_seed().to_string());
     }
@@ -21,6 +21,7 @@
 #include "cryptography/keypair.hpp"
 #include "cryptography/seed.hpp"
 #include "cryptography/signed.hpp"
+#include "cryptography/verification_batch.hpp"
 
 namespace shared_model {
   namespace crypto {
@@ -47,6 +48,14 @@ namespace shared_model {
       static bool verify(const Signed &signedData,
                          const Blob &orig,
                          const PublicKey &publicKey);
+
+      /**
+       * Verifies several signatures at once.
+       * @param batch - signatures with original messages and public keys
+       * @return verification result for every item of the batch
+       */
+      static VerificationResults verifyBatch(const VerificationBatch &batch);
+
       /**
        * Generates new seed
        * @return Seed generated
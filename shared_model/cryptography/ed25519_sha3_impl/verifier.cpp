@@ -16,9 +16,20 @@
  */
 
 #include "verifier.hpp"
+
+#include <algorithm>
+#include <future>
+#include <thread>
+#include <unordered_map>
+
 #include "cryptography/ed25519_sha3_impl/internal/ed25519_impl.hpp"
 #include "cryptography/ed25519_sha3_impl/internal/sha3_hash.hpp"
 
+namespace {
+  /// minimal number of signatures verified by a single worker of the batch
+  const size_t kMinSignaturesPerWorker = 16;
+}  // namespace
+
 namespace shared_model {
   namespace crypto {
     bool Verifier::verify(const Signed &signedData,
@@ -29,5 +40,58 @@ namespace shared_model {
           iroha::pubkey_t::from_string(toBinaryString(publicKey)),
           iroha::sig_t::from_string(toBinaryString(signedData)));
     }
+
+    VerificationResults Verifier::verifyBatch(const VerificationBatch &batch) {
+      // signatures of one model share the payload, so hash every source once
+      std::unordered_map<const Blob *, std::string> hashes;
+      std::vector<const std::string *> messages;
+      messages.reserve(batch.size());
+      for (const auto &item : batch) {
+        auto it = hashes.find(&item.source);
+        if (it == hashes.end()) {
+          it = hashes
+                   .emplace(&item.source,
+                            iroha::sha3_256(toBinaryString(item.source))
+                                .to_string())
+                   .first;
+        }
+        messages.push_back(&it->second);
+      }
+
+      // std::vector<bool> can not be written concurrently, so workers fill
+      // separate bytes
+      std::vector<char> verified(batch.size(), false);
+      auto verify_range = [&batch, &messages, &verified](size_t begin,
+                                                         size_t end) {
+        for (auto i = begin; i < end; ++i) {
+          verified[i] = iroha::verify(
+              *messages[i],
+              iroha::pubkey_t::from_string(
+                  toBinaryString(batch[i].public_key)),
+              iroha::sig_t::from_string(toBinaryString(batch[i].signed_data)));
+        }
+      };
+
+      const size_t workers =
+          std::min<size_t>(std::max(1u, std::thread::hardware_concurrency()),
+                           batch.size() / kMinSignaturesPerWorker);
+      if (workers <= 1) {
+        verify_range(0, batch.size());
+      } else {
+        const auto chunk = (batch.size() + workers - 1) / workers;
+        std::vector<std::future<void>> tasks;
+        for (auto begin = chunk; begin < batch.size(); begin += chunk) {
+          tasks.push_back(std::async(std::launch::async,
+                                     verify_range,
+                                     begin,
+                                     std::min(begin + chunk, batch.size())));
+        }
+        verify_range(0, chunk);
+        for (auto &task : tasks) {
+          task.get();
+        }
+      }
+      return VerificationResults(verified.begin(), verified.end());
+    }
   }  // namespace crypto
 }  // namespace shared_model
@@ -20,6 +20,7 @@
 
 #include "cryptography/public_key.hpp"
 #include "cryptography/signed.hpp"
+#include "cryptography/verification_batch.hpp"
 
 namespace shared_model {
   namespace crypto {
@@ -31,6 +32,14 @@ namespace shared_model {
       static bool verify(const Signed &signedData,
                          const Blob &orig,
                          const PublicKey &publicKey);
+
+      /**
+       * Verify several signatures at once. Each distinct source is hashed
+       * only once and big batches are split between worker threads
+       * @param batch - signatures to verify
+       * @return verification result for every item of the batch
+       */
+      static VerificationResults verifyBatch(const VerificationBatch &batch);
     };
 
   }  // namespace crypto
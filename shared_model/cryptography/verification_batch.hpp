@@ -0,0 +1,37 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_SHARED_MODEL_VERIFICATION_BATCH_HPP
+#define IROHA_SHARED_MODEL_VERIFICATION_BATCH_HPP
+
+#include <vector>
+
+namespace shared_model {
+  namespace crypto {
+
+    class Signed;
+    class Blob;
+    class PublicKey;
+
+    /**
+     * Single signature which should be checked as a part of the batch.
+     * Item does not own the data, so referenced objects must outlive it
+     */
+    struct VerificationItem {
+      const Signed &signed_data;
+      const Blob &source;
+      const PublicKey &public_key;
+    };
+
+    /// Collection of signatures verified in one pass
+    using VerificationBatch = std::vector<VerificationItem>;
+
+    /// Result of batch verification, i-th value corresponds to i-th item
+    using VerificationResults = std::vector<bool>;
+
+  }  // namespace crypto
+}  // namespace shared_model
+
+#endif  // IROHA_SHARED_MODEL_VERIFICATION_BATCH_HPP
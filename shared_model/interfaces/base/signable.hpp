@@ -26,6 +26,7 @@
 #include "interfaces/base/model_primitive.hpp"
 #include "interfaces/common_objects/signature.hpp"
 #include "interfaces/common_objects/types.hpp"
+#include "utils/lazy_initializer.hpp"
 #include "utils/string_builder.hpp"
 
 namespace shared_model {
@@ -45,13 +46,30 @@ namespace shared_model {
               typename HashProvider = shared_model::crypto::Sha3_256>
     class Signable : public ModelPrimitive<Model> {
      public:
+      Signable() = default;
+
+      /**
+       * Hash of the copy is not recalculated, since payload is the same
+       */
+      Signable(const Signable &other) : ModelPrimitive<Model>(other) {
+        copyHash(other);
+      }
+
+      Signable &operator=(const Signable &other) {
+        hash_.invalidate();
+        copyHash(other);
+        return *this;
+      }
+
       /**
        * @return attached signatures
        */
       virtual types::SignatureRangeType signatures() const = 0;
 
       /**
-       * Attach signature to object
+       * Attach signature to object.
+       * Note: signatures are not synchronized with readers, so object which
+       * is shared between threads should be cloned before signing
        * @param signature - signature object for insertion
        * @return true, if signature was added
        */
@@ -86,10 +104,10 @@ namespace shared_model {
                                     rhs.signatures().begin());
       }
 
+      /**
+       * @return hash of the payload, it is calculated once per object
+       */
       const types::HashType &hash() const {
-        if (hash_ == boost::none) {
-          hash_.emplace(HashProvider::makeHash(payload()));
-        }
         return *hash_;
       }
 
@@ -105,6 +123,14 @@ namespace shared_model {
       }
 
      protected:
+      /**
+       * Reuse hash already calculated by the object with the same payload
+       * @param other - object to take the hash from
+       */
+      void copyHash(const Signable &other) const {
+        hash_.copyValue(other.hash_);
+      }
+
       /**
        * Type of set of signatures
        *
@@ -142,7 +168,8 @@ namespace shared_model {
           std::unordered_set<T, SignatureSetTypeOps, SignatureSetTypeOps>;
 
      private:
-      mutable boost::optional<types::HashType> hash_;
+      const detail::LazyInitializer<types::HashType> hash_{
+          [this] { return HashProvider::makeHash(this->payload()); }};
     };
 
   }  // namespace interface
@@ -65,7 +65,8 @@ namespace shared_model {
       using PermissionSetType = std::set<PermissionNameType>;
       /// Type of Quorum used in transaction and set quorum
       using QuorumType = uint16_t;
-      /// Type of signature range, which returns when signatures are invoked
+      /// Type of signature range, which returns when signatures are invoked.
+      /// Range refers to signatures stored in the object and does not own them
       using SignatureRangeType = boost::any_range<const interface::Signature &,
                                                   boost::forward_traversal_tag>;
       /// Type of timestamp
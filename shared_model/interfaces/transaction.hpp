@@ -34,6 +34,22 @@ namespace shared_model {
     using HashProvider = shared_model::crypto::Sha3_256;
     class Transaction : public Signable<Transaction, HashProvider> {
      public:
+      Transaction() = default;
+
+      /**
+       * Hashes of the copy are not recalculated, since payload is the same
+       */
+      Transaction(const Transaction &other) : Signable(other) {
+        reduced_hash_.copyValue(other.reduced_hash_);
+      }
+
+      Transaction &operator=(const Transaction &other) {
+        Signable::operator=(other);
+        reduced_hash_.invalidate();
+        reduced_hash_.copyValue(other.reduced_hash_);
+        return *this;
+      }
+
       /**
        * @return creator of transaction
        */
@@ -44,7 +60,8 @@ namespace shared_model {
        */
       virtual types::QuorumType quorum() const = 0;
 
-      /// Type of ordered collection of commands
+      /// Type of ordered collection of commands, range refers to commands
+      /// stored in the transaction and is valid while transaction is alive
       using CommandsType = boost::any_range<Command,
                                             boost::random_access_traversal_tag,
                                             const Command &>;
@@ -59,10 +76,10 @@ namespace shared_model {
        */
       virtual const types::BlobType &reducedPayload() const = 0;
 
+      /**
+       * @return hash of the reduced payload, it is calculated once per object
+       */
       const types::HashType &reducedHash() const {
-        if (reduced_hash_ == boost::none) {
-          reduced_hash_.emplace(HashProvider::makeHash(reducedPayload()));
-        }
         return *reduced_hash_;
       }
       /*
@@ -88,8 +105,20 @@ namespace shared_model {
             .finalize();
       }
 
+     protected:
+      /**
+       * Reuse hashes already calculated by the transaction with the same
+       * payload
+       * @param other - transaction to take the hashes from
+       */
+      void copyHashes(const Transaction &other) const {
+        copyHash(other);
+        reduced_hash_.copyValue(other.reduced_hash_);
+      }
+
      private:
-      mutable boost::optional<types::HashType> reduced_hash_;
+      const detail::LazyInitializer<types::HashType> reduced_hash_{
+          [this] { return HashProvider::makeHash(this->reducedPayload()); }};
     };
 
   }  // namespace interface
@@ -0,0 +1,27 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_ORDERING_REJECTED_RESPONSE_HPP
+#define IROHA_ORDERING_REJECTED_RESPONSE_HPP
+
+#include "interfaces/transaction_responses/abstract_tx_response.hpp"
+
+namespace shared_model {
+  namespace interface {
+    /**
+     * Transaction was not accepted to the queue of ordering service because
+     * of its load, it may be sent again later
+     */
+    class OrderingRejectedResponse
+        : public AbstractTxResponse<OrderingRejectedResponse> {
+     private:
+      std::string className() const override {
+        return "OrderingRejectedResponse";
+      }
+    };
+
+  }  // namespace interface
+}  // namespace shared_model
+#endif  // IROHA_ORDERING_REJECTED_RESPONSE_HPP
@@ -13,6 +13,7 @@
 #include "interfaces/transaction_responses/committed_tx_response.hpp"
 #include "interfaces/transaction_responses/mst_expired_response.hpp"
 #include "interfaces/transaction_responses/not_received_tx_response.hpp"
+#include "interfaces/transaction_responses/ordering_rejected_response.hpp"
 #include "interfaces/transaction_responses/stateful_failed_tx_response.hpp"
 #include "interfaces/transaction_responses/stateful_valid_tx_response.hpp"
 #include "interfaces/transaction_responses/stateless_failed_tx_response.hpp"
@@ -38,6 +39,7 @@ namespace shared_model {
                                        StatefulValidTxResponse,
                                        CommittedTxResponse,
                                        MstExpiredResponse,
+                                       OrderingRejectedResponse,
                                        NotReceivedTxResponse>;
 
       /// Type with list of types in ResponseVariantType
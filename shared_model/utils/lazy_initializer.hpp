@@ -18,14 +18,22 @@
 #ifndef IROHA_LAZY_INITIALIZER_HPP
 #define IROHA_LAZY_INITIALIZER_HPP
 
-#include <boost/optional.hpp>
+#include <atomic>
 #include <functional>
+#include <mutex>
+
+#include <boost/optional.hpp>
 
 namespace shared_model {
   namespace detail {
 
     /**
-     * Lazy class for lazy converting one type to another
+     * Lazy class for lazy converting one type to another.
+     * Value is generated only once even if it is requested from several
+     * threads simultaneously; access to generated value is lock-free.
+     * Note: invalidate() must not be called concurrently with readers, so
+ * objects which invalidate their fields on modification are cloned before
+ * they are modified while shared
      * @tparam Target - output type
      */
     template <typename Target>
@@ -56,6 +64,20 @@ namespace shared_model {
       explicit LazyInitializer(T &&generator)
           : generator_(std::forward<T>(generator)) {}
 
+      LazyInitializer(const LazyInitializer &other)
+          : generator_(other.generator_) {
+        copyValue(other);
+      }
+
+      LazyInitializer(LazyInitializer &&other)
+          : generator_(std::move(other.generator_)) {
+        std::lock_guard<std::mutex> lock(other.mutex_);
+        if (other.initialized_.load(std::memory_order_acquire)) {
+          target_value_.emplace(std::move(*other.target_value_));
+          initialized_.store(true, std::memory_order_release);
+        }
+      }
+
       using PointerType = typename std::add_pointer_t<Target>;
 
       const Target &operator*() const {
@@ -63,11 +85,14 @@ namespace shared_model {
       }
 
       const PointerType ptr() const {
-        if (target_value_ == boost::none) {
-          // Use type move constructor with emplace
-          // since Target copy assignment operator could be deleted
-
-          target_value_.emplace(generator_());
+        if (not initialized_.load(std::memory_order_acquire)) {
+          std::lock_guard<std::mutex> lock(mutex_);
+          if (not initialized_.load(std::memory_order_relaxed)) {
+            // Use type move constructor with emplace
+            // since Target copy assignment operator could be deleted
+            target_value_.emplace(generator_());
+            initialized_.store(true, std::memory_order_release);
+          }
         }
         return target_value_.get_ptr();
       }
@@ -80,12 +105,30 @@ namespace shared_model {
        * Remove generated value. Next ptr() call will generate new value
        */
       void invalidate() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        initialized_.store(false, std::memory_order_release);
         target_value_ = boost::none;
       }
 
+      /**
+       * Take the value already generated by other lazy object, so that it is
+       * not generated once again. Generator of this object is preserved
+       * @param other - lazy object built from the same source data
+       */
+      void copyValue(const LazyInitializer &other) const {
+        if (not other.initialized_.load(std::memory_order_acquire)) {
+          return;
+        }
+        std::lock_guard<std::mutex> lock(mutex_);
+        target_value_.emplace(*other.target_value_);
+        initialized_.store(true, std::memory_order_release);
+      }
+
      private:
       GeneratorType generator_;
       mutable boost::optional<Target> target_value_;
+      mutable std::atomic<bool> initialized_{false};
+      mutable std::mutex mutex_;
     };
 
     /**
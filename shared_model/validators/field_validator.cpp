@@ -22,6 +22,7 @@
 #include <limits>
 #include "cryptography/crypto_provider/crypto_defaults.hpp"
 #include "cryptography/crypto_provider/crypto_verifier.hpp"
+#include "cryptography/default_hash_provider.hpp"
 #include "interfaces/queries/query_payload_meta.hpp"
 #include "validators/field_validator.hpp"
 
@@ -70,9 +71,20 @@ namespace shared_model {
     const std::regex FieldValidator::detail_key_regex_(detail_key_pattern_);
     const std::regex FieldValidator::role_id_regex_(role_id_pattern_);
 
+    /// limits of the verified signatures cache, in number of signatures
+    const uint32_t kVerifiedSignaturesHigh = 200000;
+    const uint32_t kVerifiedSignaturesLow = 150000;
+
+    iroha::cache::Cache<std::string, bool>
+        FieldValidator::verified_signatures_(kVerifiedSignaturesHigh,
+                                             kVerifiedSignaturesLow);
+
     FieldValidator::FieldValidator(time_t future_gap,
-                                   TimeFunction time_provider)
-        : future_gap_(future_gap), time_provider_(time_provider) {}
+                                   TimeFunction time_provider,
+                                   SignatureVerifier signature_verifier)
+        : future_gap_(future_gap),
+          time_provider_(time_provider),
+          signature_verifier_(std::move(signature_verifier)) {}
 
     void FieldValidator::validateAccountId(
         ReasonsGroupType &reason,
@@ -313,6 +325,13 @@ namespace shared_model {
       if (boost::empty(signatures)) {
         reason.second.push_back("Signatures cannot be empty");
       }
+
+      // malformed signatures are reported immediately, already verified ones
+      // are skipped and the rest is collected and verified in one batch
+      boost::optional<std::string> source_hash;
+      std::vector<const interface::Signature *> checked;
+      std::vector<std::string> keys;
+      crypto::VerificationBatch batch;
       for (const auto &signature : signatures) {
         const auto &sign = signature.signedData();
         const auto &pkey = signature.publicKey();
@@ -330,12 +349,37 @@ namespace shared_model {
           is_valid = false;
         }
 
-        if (is_valid
-            && not shared_model::crypto::CryptoVerifier<>::verify(
-                   sign, source, pkey)) {
-          reason.second.push_back((boost::format("Wrong signature [%s;%s]")
-                                   % sign.hex() % pkey.hex())
-                                      .str());
+        if (not is_valid) {
+          continue;
+        }
+
+        if (not source_hash) {
+          source_hash = crypto::toBinaryString(
+              crypto::DefaultHashProvider::makeHash(source));
+        }
+        auto key = *source_hash + crypto::toBinaryString(pkey)
+            + crypto::toBinaryString(sign);
+        if (verified_signatures_.findItem(key)) {
+          continue;
+        }
+
+        checked.push_back(&signature);
+        keys.push_back(std::move(key));
+        batch.push_back({sign, source, pkey});
+      }
+
+      if (batch.empty()) {
+        return;
+      }
+      auto verified = signature_verifier_(batch);
+      for (size_t i = 0; i < checked.size(); ++i) {
+        if (verified[i]) {
+          verified_signatures_.addItem(keys[i], true);
+        } else {
+          reason.second.push_back(
+              (boost::format("Wrong signature [%s;%s]")
+               % checked[i]->signedData().hex() % checked[i]->publicKey().hex())
+                  .str());
         }
       }
     }
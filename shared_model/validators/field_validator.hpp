@@ -20,6 +20,8 @@
 
 #include <regex>
 
+#include "cache/cache.hpp"
+#include "cryptography/crypto_provider/crypto_verifier.hpp"
 #include "datetime/time.hpp"
 #include "interfaces/base/signable.hpp"
 #include "interfaces/commands/command.hpp"
@@ -40,10 +42,20 @@ namespace shared_model {
       using TimeFunction = std::function<iroha::ts64_t()>;
 
      public:
+      using SignatureVerifier = std::function<crypto::VerificationResults(
+          const crypto::VerificationBatch &)>;
+
+      /**
+       * @param future_gap - gap for future transactions
+       * @param time_provider - source of current time
+       * @param signature_verifier - verifier of signatures which are not in
+       * the cache of verified signatures
+       */
       FieldValidator(time_t future_gap = kDefaultFutureGap,
-                     TimeFunction time_provider = [] {
-                       return iroha::time::now();
-                     });
+                     TimeFunction time_provider =
+                         [] { return iroha::time::now(); },
+                     SignatureVerifier signature_verifier =
+                         crypto::CryptoVerifier<>::verifyBatch);
 
       void validateAccountId(
           ReasonsGroupType &reason,
@@ -180,10 +192,19 @@ namespace shared_model {
       const static std::regex detail_key_regex_;
       const static std::regex role_id_regex_;
 
+      /**
+       * Signatures which were already verified on this node, shared by all
+       * validators. Key is the hash of signed source concatenated with the
+       * public key and the signature
+       */
+      static iroha::cache::Cache<std::string, bool> verified_signatures_;
+
       // gap for future transactions
       time_t future_gap_;
       // time provider callback
       TimeFunction time_provider_;
+      // verifier of signatures missing in the cache
+      SignatureVerifier signature_verifier_;
 
      public:
       // max-delay between tx creation and validation
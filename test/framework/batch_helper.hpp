@@ -169,7 +169,15 @@ namespace framework {
       return createUnsignedBatchTransactions(batch_type, creators, now);
     }
 
-    auto createValidBatch(const size_t &size) {
+    /**
+     * Create atomic batch of signed transactions of different creators
+     * @param size - number of transactions
+     * @param now - created time of the transactions, batches of the same size
+     * and time have the same hashes
+     * @return batch
+     */
+    auto createValidBatch(const size_t &size,
+                          size_t now = iroha::time::now()) {
       using namespace shared_model::validation;
       using TxValidator =
           TransactionValidator<FieldValidator,
@@ -187,7 +195,7 @@ namespace framework {
             batch_type, "account" + std::to_string(i) + "@domain"));
       }
 
-      auto txs = createBatchOneSignTransactions(transaction_fields);
+      auto txs = createBatchOneSignTransactions(transaction_fields, now);
       auto result_batch =
           shared_model::interface::TransactionBatch::createTransactionBatch(
               txs, TxsValidator());
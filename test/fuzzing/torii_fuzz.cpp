@@ -27,6 +27,8 @@ struct CommandFixture {
       std::shared_ptr<iroha::validation::VerifiedProposalAndErrors>>
       vprop_notifier_;
   rxcpp::subjects::subject<iroha::Commit> commit_notifier_;
+  rxcpp::subjects::subject<iroha::network::OrderingRejection>
+      rejection_notifier_;
   rxcpp::subjects::subject<iroha::DataType> mst_notifier_;
 
   CommandFixture() {
@@ -37,6 +39,8 @@ struct CommandFixture {
         .WillRepeatedly(Return(commit_notifier_.get_observable()));
     EXPECT_CALL(*pcs_, on_verified_proposal())
         .WillRepeatedly(Return(vprop_notifier_.get_observable()));
+    EXPECT_CALL(*pcs_, on_rejection())
+        .WillRepeatedly(Return(rejection_notifier_.get_observable()));
 
     mst_processor_ = std::make_shared<iroha::MockMstProcessor>();
     EXPECT_CALL(*mst_processor_, onPreparedTransactionsImpl())
@@ -67,7 +67,8 @@ class ConsensusSunnyDayTest : public ::testing::Test {
   static const size_t port = 50541;
 
   void SetUp() override {
-    network = std::make_shared<NetworkImpl>();
+    network = std::make_shared<NetworkImpl>(
+        std::make_shared<iroha::network::ChannelPool>());
     crypto = std::make_shared<FixedCryptoProvider>(std::to_string(my_num));
     timer = std::make_shared<TimerImpl>([this] {
       // static factory with a single thread
@@ -94,7 +95,8 @@ class ConsensusSunnyDayTest : public ::testing::Test {
   }
 
   void TearDown() override {
-    server->Shutdown();
+    // streams of other peers stay open, so they are cancelled by deadline
+    server->Shutdown(std::chrono::system_clock::now());
   }
 
   static uint64_t my_num, delay_before, delay_after;
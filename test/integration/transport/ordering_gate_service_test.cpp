@@ -51,7 +51,8 @@ class OrderingGateServiceTest : public ::testing::Test {
     EXPECT_CALL(*pcs_, on_commit())
         .WillRepeatedly(Return(commit_subject_.get_observable()));
 
-    service_transport = std::make_shared<OrderingServiceTransportGrpc>();
+    service_transport =
+        std::make_shared<OrderingServiceTransportGrpc>(channels);
 
     wsv = std::make_shared<MockPeerQuery>();
   }
@@ -73,7 +74,8 @@ class OrderingGateServiceTest : public ::testing::Test {
   }
 
   void initGate(std::string address) {
-    gate_transport = std::make_shared<OrderingGateTransportGrpc>(address);
+    gate_transport =
+        std::make_shared<OrderingGateTransportGrpc>(address, channels);
     gate = std::make_shared<OrderingGateImpl>(gate_transport, 1, false);
     gate->setPcs(*pcs_);
     gate_transport->subscribe(gate);
@@ -191,6 +193,7 @@ class OrderingGateServiceTest : public ::testing::Test {
   std::shared_ptr<grpc::Server> service_server;
   std::shared_ptr<grpc::Server> gate_server;
 
+  std::shared_ptr<ChannelPool> channels = std::make_shared<ChannelPool>();
   std::shared_ptr<OrderingGateTransportGrpc> gate_transport;
   std::shared_ptr<OrderingServiceTransportGrpc> service_transport;
 
@@ -80,6 +80,8 @@ class ClientServerTest : public testing::Test {
         .WillRepeatedly(Return(commit_notifier.get_observable()));
     EXPECT_CALL(*pcsMock, on_verified_proposal())
         .WillRepeatedly(Return(verified_prop_notifier.get_observable()));
+    EXPECT_CALL(*pcsMock, on_rejection())
+        .WillRepeatedly(Return(rejection_notifier.get_observable()));
 
     EXPECT_CALL(*mst, onPreparedTransactionsImpl())
         .WillRepeatedly(Return(mst_prepared_notifier.get_observable()));
@@ -133,6 +135,8 @@ class ClientServerTest : public testing::Test {
   rxcpp::subjects::subject<
       std::shared_ptr<iroha::validation::VerifiedProposalAndErrors>>
       verified_prop_notifier;
+  rxcpp::subjects::subject<iroha::network::OrderingRejection>
+      rejection_notifier;
   rxcpp::subjects::subject<iroha::DataType> mst_prepared_notifier;
   rxcpp::subjects::subject<iroha::DataType> mst_expired_notifier;
 
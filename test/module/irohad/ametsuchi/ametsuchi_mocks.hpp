@@ -274,6 +274,11 @@ namespace iroha {
                         std::shared_ptr<shared_model::interface::Block>> &));
       MOCK_METHOD0(reset, void(void));
       MOCK_METHOD0(dropStorage, void(void));
+      MOCK_CONST_METHOD0(createSnapshot, boost::optional<WsvSnapshot>(void));
+      MOCK_METHOD2(loadSnapshot,
+                   bool(const WsvSnapshot &,
+                        const std::vector<
+                            std::shared_ptr<shared_model::interface::Block>> &));
 
       rxcpp::observable<std::shared_ptr<shared_model::interface::Block>>
       on_commit() override {
@@ -0,0 +1,89 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/peer_query_cache.hpp"
+
+#include <gtest/gtest.h>
+
+#include "module/irohad/ametsuchi/ametsuchi_mocks.hpp"
+#include "module/shared_model/builders/protobuf/test_block_builder.hpp"
+#include "module/shared_model/builders/protobuf/test_transaction_builder.hpp"
+
+using namespace iroha::ametsuchi;
+using ::testing::Return;
+
+class PeerQueryCacheTest : public ::testing::Test {
+ public:
+  void SetUp() override {
+    source = std::make_shared<MockPeerQuery>();
+    cache = std::make_shared<PeerQueryCache>(source,
+                                             commits.get_observable());
+  }
+
+  /**
+   * Commit block with a single transaction
+   * @param tx - transaction of the block
+   */
+  void commit(shared_model::proto::Transaction tx) {
+    auto block = TestBlockBuilder()
+                     .transactions(std::vector<shared_model::proto::Transaction>{
+                         std::move(tx)})
+                     .build();
+    commits.get_subscriber().on_next(
+        std::make_shared<shared_model::proto::Block>(std::move(block)));
+  }
+
+  std::vector<std::shared_ptr<shared_model::interface::Peer>> peers;
+  std::shared_ptr<MockPeerQuery> source;
+  rxcpp::subjects::subject<std::shared_ptr<shared_model::interface::Block>>
+      commits;
+  std::shared_ptr<PeerQueryCache> cache;
+};
+
+/**
+ * @given peer query cache
+ * @when peers are requested several times
+ * @and block without AddPeer is committed in between
+ * @then peers are fetched from the source once
+ */
+TEST_F(PeerQueryCacheTest, PeersAreFetchedOnce) {
+  EXPECT_CALL(*source, getLedgerPeers()).WillOnce(Return(peers));
+
+  ASSERT_TRUE(cache->getLedgerPeers());
+  commit(TestTransactionBuilder().setAccountQuorum("user@test", 2).build());
+  ASSERT_TRUE(cache->getLedgerPeers());
+}
+
+/**
+ * @given peer query cache with fetched peers
+ * @when block with AddPeer is committed
+ * @then peers are fetched from the source again
+ */
+TEST_F(PeerQueryCacheTest, PeersAreFetchedAfterAddPeer) {
+  EXPECT_CALL(*source, getLedgerPeers())
+      .Times(2)
+      .WillRepeatedly(Return(peers));
+
+  ASSERT_TRUE(cache->getLedgerPeers());
+  commit(TestTransactionBuilder()
+             .addPeer("0.0.0.0:10001",
+                      shared_model::crypto::PublicKey(std::string(32, '0')))
+             .build());
+  ASSERT_TRUE(cache->getLedgerPeers());
+}
+
+/**
+ * @given peer query cache
+ * @when source fails to provide peers
+ * @then failure is not cached
+ */
+TEST_F(PeerQueryCacheTest, FailureIsNotCached) {
+  EXPECT_CALL(*source, getLedgerPeers())
+      .WillOnce(Return(boost::none))
+      .WillOnce(Return(peers));
+
+  ASSERT_FALSE(cache->getLedgerPeers());
+  ASSERT_TRUE(cache->getLedgerPeers());
+}
@@ -20,6 +20,7 @@
 #include <grpc++/grpc++.h>
 
 #include "consensus/yac/transport/impl/network_impl.hpp"
+#include "consensus/yac/transport/yac_pb_converters.hpp"
 
 using ::testing::_;
 using ::testing::InvokeWithoutArgs;
@@ -34,17 +35,13 @@ namespace iroha {
         void SetUp() override {
           notifications = std::make_shared<MockYacNetworkNotifications>();
 
-          network = std::make_shared<NetworkImpl>();
+          network = std::make_shared<NetworkImpl>(
+              std::make_shared<network::ChannelPool>());
 
           message.hash.proposal_hash = "proposal";
           message.hash.block_hash = "block";
 
-          auto sig = shared_model::proto::SignatureBuilder()
-                         .publicKey(shared_model::crypto::PublicKey("key"))
-                         .signedData(shared_model::crypto::Signed("data"))
-                         .build();
-
-          message.hash.block_signature = clone(sig);
+          message.hash.block_signature = createSig("block");
           message.signature = createSig("");
           network->subscribe(notifications);
 
@@ -61,7 +58,9 @@ namespace iroha {
         }
 
         void TearDown() override {
-          server->Shutdown();
+          // stream from the network stays open, so it is cancelled by
+          // deadline
+          server->Shutdown(std::chrono::system_clock::now());
         }
 
         std::shared_ptr<MockYacNetworkNotifications> notifications;
@@ -90,6 +89,76 @@ namespace iroha {
         std::unique_lock<std::mutex> lock(mtx);
         cv.wait_for(lock, std::chrono::milliseconds(100));
       }
+
+      /**
+       * @given initialized network
+       * @when send commit with repeated vote to itself
+       * @then commit is handled with the vote once
+       */
+      TEST_F(YacNetworkTest, RepeatedVotesAreNotSentInCommit) {
+        EXPECT_CALL(*notifications, on_commit(CommitMessage({message})))
+            .Times(1)
+            .WillRepeatedly(
+                InvokeWithoutArgs(&cv, &std::condition_variable::notify_one));
+
+        network->send_commit(*peer, CommitMessage({message, message}));
+
+        // wait for response reader thread
+        std::unique_lock<std::mutex> lock(mtx);
+        cv.wait_for(lock, std::chrono::milliseconds(100));
+      }
+
+      /**
+       * @given initialized network
+       * @when commit with votes instead of certificate is sent to it
+       * @then commit is handled
+       */
+      TEST_F(YacNetworkTest, CommitWithVotesIsHandled) {
+        EXPECT_CALL(*notifications, on_commit(CommitMessage({message})))
+            .Times(1)
+            .WillRepeatedly(
+                InvokeWithoutArgs(&cv, &std::condition_variable::notify_one));
+
+        proto::Commit commit;
+        *commit.add_votes() = PbConverters::serializeVote(message);
+        auto stub = proto::Yac::NewStub(grpc::CreateChannel(
+            peer->address(), grpc::InsecureChannelCredentials()));
+        grpc::ClientContext context;
+        google::protobuf::Empty response;
+        ASSERT_TRUE(stub->SendCommit(&context, commit, &response).ok());
+
+        // wait for response reader thread
+        std::unique_lock<std::mutex> lock(mtx);
+        cv.wait_for(lock, std::chrono::milliseconds(100));
+      }
+
+      /**
+       * @given initialized network
+       * @when commit with a valid endorsement and an endorsement with
+       * malformed public key is sent to it
+       * @then commit is handled with the valid vote only
+       */
+      TEST_F(YacNetworkTest, MalformedEndorsementIsSkipped) {
+        EXPECT_CALL(*notifications, on_commit(CommitMessage({message})))
+            .Times(1)
+            .WillRepeatedly(
+                InvokeWithoutArgs(&cv, &std::condition_variable::notify_one));
+
+        auto commit = PbConverters::serializeCommit(CommitMessage({message}));
+        auto endorsement = commit.add_endorsements();
+        endorsement->set_pubkey("malformed");
+        endorsement->set_signature("signature");
+        endorsement->set_block_signature("signature");
+        auto stub = proto::Yac::NewStub(grpc::CreateChannel(
+            peer->address(), grpc::InsecureChannelCredentials()));
+        grpc::ClientContext context;
+        google::protobuf::Empty response;
+        ASSERT_TRUE(stub->SendCommit(&context, commit, &response).ok());
+
+        // wait for response reader thread
+        std::unique_lock<std::mutex> lock(mtx);
+        cv.wait_for(lock, std::chrono::milliseconds(100));
+      }
     }  // namespace yac
   }    // namespace consensus
 }  // namespace iroha
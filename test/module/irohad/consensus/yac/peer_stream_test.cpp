@@ -0,0 +1,231 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <gtest/gtest.h>
+#include <grpc++/grpc++.h>
+
+#include "consensus/yac/transport/impl/peer_stream.hpp"
+
+using namespace iroha::consensus::yac;
+using namespace std::chrono_literals;
+
+/**
+ * Server which records frames of streams
+ */
+class StreamServer : public proto::Yac::Service {
+ public:
+  grpc::Status SendMessages(
+      grpc::ServerContext *context,
+      grpc::ServerReader<proto::Messages> *reader,
+      google::protobuf::Empty *response) override {
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      ++streams;
+      cv.notify_all();
+      cv.wait(lock, [this] { return not paused; });
+    }
+    proto::Messages frame;
+    while (reader->Read(&frame)) {
+      std::lock_guard<std::mutex> lock(mutex);
+      frames.push_back(frame);
+      for (const auto &message : frame.messages()) {
+        received.push_back(message.vote().hash().proposal());
+      }
+      cv.notify_all();
+      if (close_after_frame) {
+        break;
+      }
+    }
+    return grpc::Status::OK;
+  }
+
+  /**
+   * Wait until the predicate over the server state holds
+   * @return false on timeout
+   */
+  template <typename Predicate>
+  bool waitFor(Predicate predicate) {
+    std::unique_lock<std::mutex> lock(mutex);
+    return cv.wait_for(lock, 5s, predicate);
+  }
+
+  /**
+   * Let streams read their frames
+   */
+  void resume() {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      paused = false;
+    }
+    cv.notify_all();
+  }
+
+  std::mutex mutex;
+  std::condition_variable cv;
+  size_t streams = 0;
+  bool paused = false;
+  bool close_after_frame = false;
+  std::vector<proto::Messages> frames;
+  std::vector<std::string> received;
+};
+
+class PeerStreamTest : public ::testing::Test {
+ public:
+  void SetUp() override {
+    channels = std::make_shared<iroha::network::ChannelPool>();
+  }
+
+  void TearDown() override {
+    // stream is cancelled before the server, so that the handler returns
+    stream.reset();
+    if (server) {
+      server->Shutdown(std::chrono::system_clock::now());
+    }
+  }
+
+  /**
+   * Start server with the service
+   * @param port - port to listen, 0 to choose any
+   */
+  void startServer(int port = 0) {
+    grpc::ServerBuilder builder;
+    builder.AddListeningPort("127.0.0.1:" + std::to_string(port),
+                             grpc::InsecureServerCredentials(),
+                             &port);
+    builder.RegisterService(&service);
+    server = builder.BuildAndStart();
+    ASSERT_TRUE(server);
+    ASSERT_NE(0, port);
+    address = "127.0.0.1:" + std::to_string(port);
+  }
+
+  /**
+   * @return message which is identified by the proposal hash
+   */
+  static proto::Message makeMessage(const std::string &proposal) {
+    proto::Message message;
+    message.mutable_vote()->mutable_hash()->set_proposal(proposal);
+    return message;
+  }
+
+  std::shared_ptr<iroha::network::ChannelPool> channels;
+  StreamServer service;
+  std::unique_ptr<grpc::Server> server;
+  std::string address;
+  std::unique_ptr<PeerStream> stream;
+};
+
+/**
+ * @given stream to the server
+ * @when more messages than fit into one frame are sent
+ * @then all of them are received in order, in frames of limited size
+ */
+TEST_F(PeerStreamTest, LimitsFrameSize) {
+  startServer();
+  stream = std::make_unique<PeerStream>(channels, address);
+
+  const size_t count = 3 * PeerStream::kMaxFrameMessages;
+  for (size_t i = 0; i < count; ++i) {
+    stream->send(makeMessage(std::to_string(i)));
+  }
+
+  ASSERT_TRUE(service.waitFor([&] { return service.received.size() == count; }));
+  std::lock_guard<std::mutex> lock(service.mutex);
+  for (const auto &frame : service.frames) {
+    ASSERT_GE(PeerStream::kMaxFrameMessages,
+              static_cast<size_t>(frame.messages_size()));
+  }
+  for (size_t i = 0; i < count; ++i) {
+    ASSERT_EQ(std::to_string(i), service.received[i]);
+  }
+}
+
+/**
+ * @given stream which is blocked writing a large frame to the server which
+ * does not read
+ * @when more messages than the queue holds are sent
+ * @then the oldest messages are dropped and the rest is received
+ */
+TEST_F(PeerStreamTest, DropsOldestMessagesWhenQueueIsFull) {
+  service.paused = true;
+  startServer();
+  stream = std::make_unique<PeerStream>(channels, address);
+
+  // frame is larger than flow control window, so it is not written until
+  // the server reads it
+  stream->send(makeMessage(std::string(3 * 1024 * 1024, 'a')));
+  // stream is opened after the first frame is taken from the queue
+  ASSERT_TRUE(service.waitFor([&] { return service.streams == 1; }));
+
+  const size_t dropped = 10;
+  const size_t count = PeerStream::kMaxPendingMessages + dropped;
+  for (size_t i = 0; i < count; ++i) {
+    stream->send(makeMessage(std::to_string(i)));
+  }
+  service.resume();
+
+  ASSERT_TRUE(service.waitFor([&] {
+    return service.received.size() == PeerStream::kMaxPendingMessages + 1;
+  }));
+  std::lock_guard<std::mutex> lock(service.mutex);
+  ASSERT_EQ(std::to_string(dropped), service.received[1]);
+  ASSERT_EQ(std::to_string(count - 1), service.received.back());
+}
+
+/**
+ * @given stream to the server which closes every stream after one frame
+ * @when the next message is sent after the stream was closed
+ * @then the stream is reopened and the message is received
+ */
+TEST_F(PeerStreamTest, ReopensClosedStream) {
+  service.close_after_frame = true;
+  startServer();
+  stream = std::make_unique<PeerStream>(channels, address);
+
+  stream->send(makeMessage("first"));
+  ASSERT_TRUE(service.waitFor([&] { return service.received.size() == 1; }));
+  // let the client learn that the stream is finished
+  std::this_thread::sleep_for(200ms);
+
+  stream->send(makeMessage("second"));
+  ASSERT_TRUE(service.waitFor([&] { return service.received.size() == 2; }));
+  std::lock_guard<std::mutex> lock(service.mutex);
+  ASSERT_EQ(2, service.streams);
+  ASSERT_EQ("second", service.received.back());
+}
+
+/**
+ * @given stream to the peer which is not available
+ * @when message is sent, and then the peer becomes available
+ * @then the message is dropped after the retry, and later messages are
+ * received
+ */
+TEST_F(PeerStreamTest, DropsFrameWhenPeerIsUnavailable) {
+  // reserve the port and stop the server
+  startServer();
+  auto port = address.substr(address.rfind(':') + 1);
+  server->Shutdown(std::chrono::system_clock::now());
+  server.reset();
+
+  stream = std::make_unique<PeerStream>(channels, address);
+  stream->send(makeMessage("lost"));
+  // both attempts to write fail fast
+  std::this_thread::sleep_for(100ms);
+
+  startServer(std::stoi(port));
+  // the channel may wait for its reconnect backoff, so messages are sent
+  // until one of them is received
+  auto received = false;
+  for (auto attempt = 0; attempt < 10 and not received; ++attempt) {
+    stream->send(makeMessage("delivered"));
+    received = service.waitFor([&] { return not service.received.empty(); });
+  }
+  ASSERT_TRUE(received);
+
+  std::lock_guard<std::mutex> lock(service.mutex);
+  for (const auto &message : service.received) {
+    ASSERT_EQ("delivered", message);
+  }
+}
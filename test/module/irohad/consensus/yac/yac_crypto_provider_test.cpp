@@ -70,6 +70,30 @@ namespace iroha {
         ASSERT_FALSE(crypto_provider->verify(vote));
       }
 
+      /**
+       * @given vote which was verified on its own
+       * @when commit with this vote and a vote with changed message arrives
+       * @then commit is invalid, so verified votes do not hide invalid ones
+       * @and commit with the verified vote and a valid vote is correct
+       */
+      TEST_F(YacCryptoProviderTest, CommitWithAlreadyVerifiedVote) {
+        YacHash hash("1", "1");
+        auto verified_vote = crypto_provider->getVote(hash);
+        ASSERT_TRUE(crypto_provider->verify(verified_vote));
+
+        CryptoProviderImpl other_peer(
+            shared_model::crypto::DefaultCryptoAlgorithmType::
+                generateKeypair());
+        auto other_vote = other_peer.getVote(hash);
+        auto changed_vote = other_vote;
+        changed_vote.hash.block_hash = "hash changed";
+
+        ASSERT_FALSE(crypto_provider->verify(
+            CommitMessage({verified_vote, changed_vote})));
+        ASSERT_TRUE(crypto_provider->verify(
+            CommitMessage({verified_vote, other_vote})));
+      }
+
     }  // namespace yac
   }    // namespace consensus
 }  // namespace iroha
@@ -0,0 +1,103 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <gtest/gtest.h>
+
+#include "consensus/yac/storage/yac_vote_storage.hpp"
+#include "module/irohad/consensus/yac/yac_mocks.hpp"
+
+using namespace iroha::consensus::yac;
+
+class YacVoteStorageTest : public ::testing::Test {
+ public:
+  static constexpr size_t kRetainedRounds = 2;
+  static constexpr uint64_t kPeers = 4;
+
+  YacVoteStorage storage{kRetainedRounds};
+
+  /**
+   * Store commit for given round and mark it as processed
+   * @param round - number used for proposal and block hashes
+   */
+  void commitRound(size_t round) {
+    YacHash hash(std::to_string(round), std::to_string(round));
+    std::vector<VoteMessage> votes;
+    for (auto i = 0u; i < kPeers; ++i) {
+      votes.push_back(create_vote(hash, std::to_string(i)));
+    }
+    ASSERT_TRUE(storage.store(CommitMessage(votes), kPeers));
+    storage.markAsProcessedState(hash.proposal_hash);
+  }
+};
+
+/**
+ * @given vote storage which retains two rounds
+ * @when four rounds are committed
+ * @then the two most recent rounds preceding the last one are kept
+ * @and older rounds are evicted, and stay processed
+ */
+TEST_F(YacVoteStorageTest, EvictsRoundsBeforeRetainedWindow) {
+  for (auto round = 0u; round < 4; ++round) {
+    commitRound(round);
+  }
+
+  EXPECT_FALSE(storage.isHashCommitted("0"));
+  EXPECT_TRUE(storage.getProcessingState("0"));
+  for (auto round : {1u, 2u, 3u}) {
+    EXPECT_TRUE(storage.isHashCommitted(std::to_string(round)));
+    EXPECT_TRUE(storage.getProcessingState(std::to_string(round)));
+  }
+}
+
+/**
+ * @given vote storage with a committed round
+ * @when vote for the round is stored again
+ * @then commit is returned from the existing storage
+ */
+TEST_F(YacVoteStorageTest, VoteForStoredRoundReturnsCommit) {
+  commitRound(0);
+
+  auto answer = storage.store(create_vote(YacHash("0", "0"), "0"), kPeers);
+  ASSERT_TRUE(answer);
+  ASSERT_NO_THROW(boost::get<CommitMessage>(*answer));
+}
+
+/**
+ * @given vote storage where a committed round was evicted
+ * @when commit for the evicted round is stored again
+ * @then it is refused and the round stays processed
+ */
+TEST_F(YacVoteStorageTest, LateCommitForEvictedRoundIsRefused) {
+  for (auto round = 0u; round < 4; ++round) {
+    commitRound(round);
+  }
+
+  YacHash hash("0", "0");
+  std::vector<VoteMessage> votes;
+  for (auto i = 0u; i < kPeers; ++i) {
+    votes.push_back(create_vote(hash, std::to_string(i)));
+  }
+  EXPECT_FALSE(storage.store(CommitMessage(votes), kPeers));
+  EXPECT_FALSE(storage.store(votes.front(), kPeers));
+  EXPECT_FALSE(storage.isHashCommitted("0"));
+  EXPECT_TRUE(storage.getProcessingState("0"));
+}
+
+/**
+ * @given vote storage which remembers one evicted round
+ * @when two rounds are evicted
+ * @then only the last evicted round is refused
+ */
+TEST_F(YacVoteStorageTest, RemembersLimitedNumberOfEvictedRounds) {
+  YacVoteStorage storage(kRetainedRounds, 1);
+  for (auto round = 0u; round < 5; ++round) {
+    YacHash hash(std::to_string(round), std::to_string(round));
+    storage.store(create_vote(hash, "0"), kPeers);
+    storage.markAsProcessedState(hash.proposal_hash);
+  }
+
+  EXPECT_FALSE(storage.getProcessingState("0"));
+  EXPECT_TRUE(storage.getProcessingState("1"));
+}
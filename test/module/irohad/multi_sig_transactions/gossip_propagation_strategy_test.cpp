@@ -89,7 +89,8 @@ PropagationData subscribeAndEmit(boost::optional<PropagationData> data,
                                  uint32_t take) {
   auto query = std::make_shared<MockPeerQuery>();
   EXPECT_CALL(*query, getLedgerPeers()).WillRepeatedly(testing::Return(data));
-  GossipPropagationStrategy strategy(query, period, amount);
+  GossipPropagationStrategy strategy(
+      query, period, amount, std::make_shared<timer::TimerWheel>());
   return subscribeAndEmit(strategy, take);
 }
 
@@ -192,7 +193,8 @@ TEST(GossipPropagationStrategyTest, MultipleSubsEmission) {
 
   auto query = std::make_shared<MockPeerQuery>();
   EXPECT_CALL(*query, getLedgerPeers()).WillRepeatedly(testing::Return(peers));
-  GossipPropagationStrategy strategy(query, 1ms, amount);
+  GossipPropagationStrategy strategy(
+      query, 1ms, amount, std::make_shared<timer::TimerWheel>());
 
   // Create separate subscriber for every thread
   // Use result[i] as storage for emitent for i-th one
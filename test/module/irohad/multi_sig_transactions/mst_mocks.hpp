@@ -46,6 +46,7 @@ namespace iroha {
         onNewState,
         void(const std::shared_ptr<shared_model::interface::Peer> &peer,
              const MstState &state));
+    MOCK_METHOD1(onSummary, TransactionHashes(const MstSummary &summary));
   };
 
   /**
@@ -47,6 +47,20 @@ TEST(StateTest, UpdateExistingState) {
   ASSERT_EQ(2, boost::size(state.getTransactions().begin()->get()->signatures()));
 }
 
+TEST(StateTest, UpdateDoesNotModifyInsertedTransaction) {
+  log_->info(
+      "Create empty state => insert tx with one signature => "
+      "insert tx with another signature => check the first tx");
+
+  auto state = MstState::empty();
+  auto time = iroha::time::now();
+  auto tx = makeTx(1, time);
+  state += tx;
+  state += makeTx(1, time);
+  ASSERT_EQ(1, boost::size(tx->signatures()));
+  ASSERT_EQ(2, boost::size(state.find(tx)->signatures()));
+}
+
 TEST(StateTest, UpdateStateWhenTransacionsSame) {
   log_->info("Create empty state => insert two equal transaction");
 
@@ -250,3 +264,25 @@ TEST(StateTest, RemovingTestWhenByTimeExpired) {
   ASSERT_EQ(0, diff_state.getTransactions().size());
   ASSERT_EQ(2, expired_state.getTransactions().size());
 }
+
+TEST(StateTest, MissingTransactionsOfSummary) {
+  log_->info(
+      "Create two states with common transaction, signed differently => "
+      "request transactions of summary of one state by other");
+
+  auto time = iroha::time::now();
+  auto key = makeKey();
+
+  auto state1 = MstState::empty();
+  state1 += makeTx(1, time, key);
+  state1 += makeTx(2, time, key);
+  state1 += makeTx(3, time, key);
+
+  auto state2 = MstState::empty();
+  state2 += makeTx(1, time, key);
+  state2 += makeTx(2, time, makeKey());
+
+  auto missing = state2.missing(state1.summary());
+  ASSERT_EQ(2, missing.size());
+  ASSERT_EQ(0, state1.missing(state1.summary()).size());
+}
@@ -16,6 +16,7 @@
  */
 
 #include <gtest/gtest.h>
+#include <boost/range/size.hpp>
 #include <memory>
 #include "logger/logger.hpp"
 #include "module/irohad/multi_sig_transactions/mst_test_helpers.hpp"
@@ -108,3 +109,84 @@ TEST_F(StorageTest, StorageWhenCreate) {
                 .getTransactions()
                 .size());
 }
+
+TEST_F(StorageTest, PropagationContainsOnlyChanges) {
+  log_->info(
+      "propagate fixture state => propagate it again => "
+      "add transaction => propagate it again");
+
+  ASSERT_EQ(3,
+            storage->getPropagationState(absent_peer, creation_time)
+                .getTransactions()
+                .size());
+  ASSERT_EQ(0,
+            storage->getPropagationState(absent_peer, creation_time)
+                .getTransactions()
+                .size());
+
+  storage->updateOwnState(makeTx(4, creation_time));
+  ASSERT_EQ(1,
+            storage->getPropagationState(absent_peer, creation_time)
+                .getTransactions()
+                .size());
+}
+
+TEST_F(StorageTest, PropagationContainsNewSignatures) {
+  log_->info(
+      "propagate fixture state => sign propagated transaction => "
+      "propagate it again");
+
+  storage->getPropagationState(absent_peer, creation_time);
+  storage->updateOwnState(makeTx(1, creation_time, makeKey()));
+
+  auto propagated =
+      storage->getPropagationState(absent_peer, creation_time)
+          .getTransactions();
+  ASSERT_EQ(1, propagated.size());
+  ASSERT_EQ(2, boost::size(propagated.front()->signatures()));
+}
+
+TEST_F(StorageTest, PropagationSkipsStateOfPeer) {
+  log_->info(
+      "apply state of peer => propagate own state to the peer and "
+      "to another peer");
+
+  auto peer = makePeer("localhost:50052", "another");
+  auto new_state = MstState::empty(std::make_shared<StorageTestCompleter>());
+  new_state += makeTx(5, creation_time);
+  storage->apply(peer, new_state);
+
+  ASSERT_EQ(3,
+            storage->getPropagationState(peer, creation_time)
+                .getTransactions()
+                .size());
+  ASSERT_EQ(4,
+            storage->getPropagationState(absent_peer, creation_time)
+                .getTransactions()
+                .size());
+}
+
+TEST_F(StorageTest, PropagationAfterResetContainsWholeState) {
+  log_->info("propagate fixture state => reset propagation => propagate it");
+
+  storage->getPropagationState(absent_peer, creation_time);
+  storage->resetPropagation(*absent_peer);
+
+  ASSERT_EQ(3,
+            storage->getPropagationState(absent_peer, creation_time)
+                .getTransactions()
+                .size());
+}
+
+TEST_F(StorageTest, PropagationContainsCopiesOfTransactions) {
+  log_->info("add transaction => propagate it => compare with the added one");
+
+  auto tx = makeTx(4, creation_time);
+  storage->updateOwnState(tx);
+  auto propagated =
+      storage->getPropagationState(absent_peer, creation_time).find(tx);
+
+  ASSERT_TRUE(propagated);
+  ASSERT_NE(tx, propagated);
+  ASSERT_EQ(*tx, *propagated);
+}
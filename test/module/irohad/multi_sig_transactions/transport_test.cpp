@@ -19,6 +19,7 @@
 #include "module/irohad/multi_sig_transactions/mst_mocks.hpp"
 #include "module/irohad/multi_sig_transactions/mst_test_helpers.hpp"
 #include "multi_sig_transactions/state/mst_state.hpp"
+#include "multi_sig_transactions/storage/mst_storage_impl.hpp"
 #include "multi_sig_transactions/transport/mst_transport_grpc.hpp"
 
 using namespace iroha::network;
@@ -37,9 +38,13 @@ using ::testing::InvokeWithoutArgs;
  * AND MstState for transfer
  * @when Send state via transport
  * @then Assume that received state same as sent
+ * AND the sender is reported as the peer of the state
  */
 TEST(TransportTest, SendAndReceive) {
-  auto transport = std::make_shared<MstTransportGrpc>();
+  auto my_peer =
+      makePeer("localhost:50541", "bcdebcdebcdebcdebcdebcdebcdebcde");
+  auto transport = std::make_shared<MstTransportGrpc>(
+      std::make_shared<ChannelPool>(), my_peer);
   auto notifications = std::make_shared<iroha::MockMstTransportNotification>();
   transport->subscribe(notifications);
 
@@ -48,6 +53,15 @@ TEST(TransportTest, SendAndReceive) {
   ON_CALL(*notifications, onNewState(_, _))
       .WillByDefault(
           InvokeWithoutArgs(&cv, &std::condition_variable::notify_one));
+  // all transactions of the summary are requested
+  ON_CALL(*notifications, onSummary(_))
+      .WillByDefault(Invoke([](const iroha::MstSummary &summary) {
+        iroha::TransactionHashes hashes;
+        for (const auto &tx : summary) {
+          hashes.push_back(tx.hash);
+        }
+        return hashes;
+      }));
 
   auto state = iroha::MstState::empty();
   state += makeTx(1, iroha::time::now(), makeKey(), 3);
@@ -70,9 +84,9 @@ TEST(TransportTest, SendAndReceive) {
   std::shared_ptr<shared_model::interface::Peer> peer =
       makePeer(addr + std::to_string(port), "abcdabcdabcdabcdabcdabcdabcdabcd");
   // we want to ensure that server side will call onNewState()
-  // with same parameters as on the client side
+  // with the state and the peer which sent it
   EXPECT_CALL(*notifications, onNewState(_, state))
-      .WillOnce(Invoke([&peer](auto &p, auto) { EXPECT_EQ(*p, *peer); }));
+      .WillOnce(Invoke([&my_peer](auto &p, auto) { EXPECT_EQ(*p, *my_peer); }));
 
   transport->sendState(*peer, state);
   std::unique_lock<std::mutex> lock(mtx);
@@ -80,3 +94,133 @@ TEST(TransportTest, SendAndReceive) {
 
   server->Shutdown();
 }
+
+/**
+ * @given Initialized transport
+ * AND MstState for transfer
+ * AND receiver which has all transactions of the state except one
+ * @when Send state via transport
+ * @then Only the missing transaction is received
+ */
+TEST(TransportTest, SendsOnlyRequestedTransactions) {
+  auto my_peer =
+      makePeer("localhost:50541", "bcdebcdebcdebcdebcdebcdebcdebcde");
+  auto transport = std::make_shared<MstTransportGrpc>(
+      std::make_shared<ChannelPool>(), my_peer);
+  auto notifications = std::make_shared<iroha::MockMstTransportNotification>();
+  transport->subscribe(notifications);
+
+  auto time = iroha::time::now();
+  auto missing_tx = makeTx(1, time, makeKey(), 3);
+  auto state = iroha::MstState::empty();
+  state += missing_tx;
+  state += makeTx(2, time, makeKey(), 3);
+  state += makeTx(3, time, makeKey(), 3);
+
+  auto expected_state = iroha::MstState::empty();
+  expected_state += missing_tx;
+
+  std::mutex mtx;
+  std::condition_variable cv;
+  EXPECT_CALL(*notifications, onSummary(_))
+      .WillOnce(Invoke([&missing_tx](const iroha::MstSummary &summary) {
+        EXPECT_EQ(3, summary.size());
+        return iroha::TransactionHashes{missing_tx->hash()};
+      }));
+  EXPECT_CALL(*notifications, onNewState(_, expected_state))
+      .WillOnce(InvokeWithoutArgs(&cv, &std::condition_variable::notify_one));
+
+  std::unique_ptr<grpc::Server> server;
+
+  grpc::ServerBuilder builder;
+  int port = 0;
+  std::string addr = "localhost:";
+  builder.AddListeningPort(
+      addr + "0", grpc::InsecureServerCredentials(), &port);
+  builder.RegisterService(transport.get());
+  server = builder.BuildAndStart();
+  ASSERT_TRUE(server);
+  ASSERT_NE(port, 0);
+
+  auto peer =
+      makePeer(addr + std::to_string(port), "abcdabcdabcdabcdabcdabcdabcdabcd");
+  transport->sendState(*peer, state);
+  std::unique_lock<std::mutex> lock(mtx);
+  cv.wait_for(lock, std::chrono::milliseconds(100));
+
+  server->Shutdown();
+}
+
+/**
+ * @given two peers with their storages, connected by transports
+ * AND the first peer has transactions in its own state
+ * @when the first peer propagates its state to the second one
+ * @then the second peer records the state under the key of the first peer
+ * AND does not propagate the received transactions back to it
+ * AND propagates them to other peers
+ */
+TEST(TransportTest, ReceiverRecordsStateOfSender) {
+  auto completer = std::make_shared<iroha::DefaultCompleter>();
+  auto storage_a = std::make_shared<iroha::MstStorageStateImpl>(completer);
+  auto storage_b = std::make_shared<iroha::MstStorageStateImpl>(completer);
+  storage_a->updateOwnState(makeTx(1, iroha::time::now(), makeKey(), 3));
+  storage_a->updateOwnState(makeTx(2, iroha::time::now(), makeKey(), 3));
+
+  auto peer_a =
+      makePeer("localhost:50541", "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa");
+  auto transport_a = std::make_shared<MstTransportGrpc>(
+      std::make_shared<ChannelPool>(), peer_a);
+  auto transport_b = std::make_shared<MstTransportGrpc>(
+      std::make_shared<ChannelPool>(),
+      makePeer("localhost:50542", "bbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbb"));
+  auto notifications = std::make_shared<iroha::MockMstTransportNotification>();
+  transport_b->subscribe(notifications);
+
+  std::mutex mtx;
+  std::condition_variable cv;
+  bool received = false;
+  ON_CALL(*notifications, onSummary(_))
+      .WillByDefault(Invoke([&storage_b](const iroha::MstSummary &summary) {
+        return storage_b->whatsMissing(summary);
+      }));
+  EXPECT_CALL(*notifications, onNewState(_, _))
+      .WillOnce(Invoke([&](const auto &from, const auto &state) {
+        storage_b->apply(from, state);
+        std::lock_guard<std::mutex> lock(mtx);
+        received = true;
+        cv.notify_one();
+      }));
+
+  grpc::ServerBuilder builder;
+  int port = 0;
+  std::string addr = "localhost:";
+  builder.AddListeningPort(
+      addr + "0", grpc::InsecureServerCredentials(), &port);
+  builder.RegisterService(transport_b.get());
+  auto server = builder.BuildAndStart();
+  ASSERT_TRUE(server);
+  ASSERT_NE(port, 0);
+
+  auto peer_b =
+      makePeer(addr + std::to_string(port), "bbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbb");
+  transport_a->sendState(
+      *peer_b, storage_a->getPropagationState(peer_b, iroha::time::now()));
+  {
+    std::unique_lock<std::mutex> lock(mtx);
+    ASSERT_TRUE(cv.wait_for(
+        lock, std::chrono::seconds(5), [&received] { return received; }));
+  }
+
+  auto other_peer =
+      makePeer("localhost:50543", "cccccccccccccccccccccccccccccccc");
+  ASSERT_EQ(0,
+            storage_b->getPropagationState(peer_a, iroha::time::now())
+                .getTransactions()
+                .size());
+  ASSERT_EQ(2,
+            storage_b->getPropagationState(other_peer, iroha::time::now())
+                .getTransactions()
+                .size());
+
+  server->Shutdown();
+}
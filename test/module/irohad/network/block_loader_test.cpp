@@ -15,6 +15,12 @@
  * limitations under the License.
  */
 
+#include <atomic>
+#include <condition_variable>
+#include <future>
+#include <mutex>
+#include <thread>
+
 #include <grpc++/security/server_credentials.h>
 #include <grpc++/server.h>
 #include <grpc++/server_builder.h>
@@ -37,6 +43,7 @@ using namespace iroha::ametsuchi;
 using namespace framework::test_subscriber;
 using namespace shared_model::crypto;
 
+using testing::_;
 using testing::A;
 using testing::Return;
 
@@ -48,7 +55,8 @@ class BlockLoaderTest : public testing::Test {
   void SetUp() override {
     peer_query = std::make_shared<MockPeerQuery>();
     storage = std::make_shared<MockBlockQuery>();
-    loader = std::make_shared<BlockLoaderImpl>(peer_query, storage);
+    loader = std::make_shared<BlockLoaderImpl>(
+        peer_query, storage, std::make_shared<ChannelPool>());
     service = std::make_shared<BlockLoaderService>(storage);
 
     grpc::ServerBuilder builder;
@@ -201,6 +209,85 @@ TEST_F(BlockLoaderTest, ValidWhenMultipleBlocks) {
   ASSERT_TRUE(wrapper.validate());
 }
 
+/**
+ * @given block loader and more missing blocks than fit into one range
+ * @when retrieveBlocks is called for the signatories of the last block
+ * @then all missing blocks are returned in order of height
+ */
+TEST_F(BlockLoaderTest, ValidWhenSeveralRanges) {
+  const shared_model::interface::types::HeightType top_height = 1;
+  const shared_model::interface::types::HeightType height = 130;
+
+  std::vector<wBlock> blocks;
+  for (auto i = top_height + 1; i <= height; ++i) {
+    auto blk = getBaseBlockBuilder()
+                   .height(i)
+                   .build()
+                   .signAndAddSignature(key)
+                   .finish();
+    blocks.emplace_back(clone(blk));
+  }
+
+  EXPECT_CALL(*peer_query, getLedgerPeers())
+      .WillOnce(Return(std::vector<wPeer>{peer}));
+  EXPECT_CALL(*storage, getTopBlockHeight()).WillOnce(Return(top_height));
+  EXPECT_CALL(*storage, getBlocks(_, _))
+      .WillRepeatedly(testing::Invoke([&blocks, top_height](auto begin,
+                                                            auto count) {
+        auto first = blocks.begin() + (begin - top_height - 1);
+        return std::vector<wBlock>(
+            first, first + std::min<size_t>(count, blocks.end() - first));
+      }));
+  auto wrapper = make_test_subscriber<CallExact>(
+      loader->retrieveBlocks({peer_key}, height), height - top_height);
+  auto next_height = top_height + 1;
+  wrapper.subscribe([this, &next_height](const auto &loaded) {
+    ASSERT_EQ(loaded.block->height(), next_height++);
+    ASSERT_EQ(loaded.peer, peer_key);
+  });
+
+  ASSERT_TRUE(wrapper.validate());
+}
+
+/**
+ * @given block loader and missing blocks, one of which has invalid signature
+ * @when retrieveBlocks is called for the only peer
+ * @then only blocks before the invalid one are returned
+ */
+TEST_F(BlockLoaderTest, InvalidWhenBlockSignatureIsWrong) {
+  const shared_model::interface::types::HeightType top_height = 1;
+  const shared_model::interface::types::HeightType height = 4;
+
+  std::vector<wBlock> blocks;
+  for (auto i = top_height + 1; i <= height; ++i) {
+    auto blk = getBaseBlockBuilder()
+                   .height(i)
+                   .build()
+                   .signAndAddSignature(key)
+                   .finish();
+    blocks.emplace_back(clone(blk));
+  }
+  // payload is changed after signing, so the signature does not match
+  auto transport =
+      static_cast<shared_model::proto::Block &>(*blocks[1]).getTransport();
+  transport.mutable_payload()->set_created_time(
+      transport.payload().created_time() + 1);
+  blocks[1] = std::make_shared<shared_model::proto::Block>(transport);
+
+  EXPECT_CALL(*peer_query, getLedgerPeers())
+      .WillRepeatedly(Return(std::vector<wPeer>{peer}));
+  EXPECT_CALL(*storage, getTopBlockHeight()).WillOnce(Return(top_height));
+  EXPECT_CALL(*storage, getBlocks(top_height + 1, height - top_height))
+      .WillOnce(Return(blocks));
+  auto wrapper = make_test_subscriber<CallExact>(
+      loader->retrieveBlocks({peer_key}, height), 1);
+  wrapper.subscribe([top_height](const auto &loaded) {
+    ASSERT_EQ(loaded.block->height(), top_height + 1);
+  });
+
+  ASSERT_TRUE(wrapper.validate());
+}
+
 /**
  * @given block loader with a block
  * @when retrieveBlock is called with the related hash
@@ -239,3 +326,285 @@ TEST_F(BlockLoaderTest, ValidWhenBlockMissing) {
 
   ASSERT_FALSE(block);
 }
+
+class MultiPeerBlockLoaderTest : public BlockLoaderTest {
+ public:
+  void SetUp() override {
+    BlockLoaderTest::SetUp();
+    other_storage = std::make_shared<MockBlockQuery>();
+    other_service = std::make_shared<BlockLoaderService>(other_storage);
+
+    grpc::ServerBuilder builder;
+    int port = 0;
+    builder.AddListeningPort(
+        "0.0.0.0:0", grpc::InsecureServerCredentials(), &port);
+    builder.RegisterService(other_service.get());
+    other_server = builder.BuildAndStart();
+    ASSERT_TRUE(other_server);
+    ASSERT_NE(port, 0);
+
+    shared_model::builder::PeerBuilder<
+        shared_model::proto::PeerBuilder,
+        shared_model::validation::FieldValidator>()
+        .address("0.0.0.0:" + std::to_string(port))
+        .pubkey(other_peer_key)
+        .build()
+        .match(
+            [&](iroha::expected::Value<
+                std::shared_ptr<shared_model::interface::Peer>> &v) {
+              other_peer = std::move(v.value);
+            },
+            [](iroha::expected::Error<std::shared_ptr<std::string>>) {});
+
+    EXPECT_CALL(*peer_query, getLedgerPeers())
+        .WillRepeatedly(Return(std::vector<wPeer>{peer, other_peer}));
+    EXPECT_CALL(*storage, getTopBlockHeight()).WillOnce(Return(kTopHeight));
+  }
+
+  /**
+   * @param height - height of the last block
+   * @return signed blocks after the top block up to the height
+   */
+  std::vector<wBlock> makeBlocks(
+      shared_model::interface::types::HeightType height) const {
+    std::vector<wBlock> blocks;
+    for (auto i = kTopHeight + 1; i <= height; ++i) {
+      blocks.emplace_back(clone(getBaseBlockBuilder()
+                                    .height(i)
+                                    .build()
+                                    .signAndAddSignature(key)
+                                    .finish()));
+    }
+    return blocks;
+  }
+
+  /**
+   * @return requested part of the blocks, as storage of a peer returns it
+   */
+  static std::vector<wBlock> slice(
+      const std::vector<wBlock> &blocks,
+      shared_model::interface::types::HeightType begin,
+      uint32_t count) {
+    auto first = blocks.begin() + (begin - kTopHeight - 1);
+    return std::vector<wBlock>(
+        first, first + std::min<size_t>(count, blocks.end() - first));
+  }
+
+  /**
+   * Subscribe to retrieval of blocks up to the height, which are checked
+   * to be emitted in order of height
+   * @param height - height of the last block
+   * @param on_next - called for each block after the check
+   * @return true if all blocks were emitted
+   */
+  template <typename OnNext>
+  bool retrieveAll(shared_model::interface::types::HeightType height,
+                   OnNext on_next) {
+    auto wrapper = make_test_subscriber<CallExact>(
+        loader->retrieveBlocks({peer_key, other_peer_key}, height),
+        height - kTopHeight);
+    auto next_height = kTopHeight + 1;
+    wrapper.subscribe([&next_height, &on_next](const auto &loaded) {
+      ASSERT_EQ(loaded.block->height(), next_height++);
+      on_next(loaded);
+    });
+    return wrapper.validate();
+  }
+
+  static constexpr shared_model::interface::types::HeightType kTopHeight = 1;
+  /// same as number of blocks requested by loader at once
+  static constexpr shared_model::interface::types::HeightType kRange = 64;
+
+  std::shared_ptr<shared_model::interface::Peer> other_peer;
+  PublicKey other_peer_key =
+      DefaultCryptoAlgorithmType::generateKeypair().publicKey();
+  std::shared_ptr<MockBlockQuery> other_storage;
+  std::shared_ptr<BlockLoaderService> other_service;
+  std::unique_ptr<grpc::Server> other_server;
+};
+
+constexpr shared_model::interface::types::HeightType
+    MultiPeerBlockLoaderTest::kTopHeight;
+constexpr shared_model::interface::types::HeightType
+    MultiPeerBlockLoaderTest::kRange;
+
+/**
+ * @given block loader and two peers which have all missing blocks
+ * @when retrieveBlocks is called for both peers
+ * @then ranges of blocks are downloaded from both of them
+ * @and all blocks are returned in order of height
+ */
+TEST_F(MultiPeerBlockLoaderTest, SplitsRangesBetweenPeers) {
+  const auto height = kTopHeight + 4 * kRange;
+  auto blocks = makeBlocks(height);
+
+  // the first peer serves its range after the second one has taken a range,
+  // so neither of them downloads everything
+  std::promise<void> other_requested;
+  auto other_requested_future = other_requested.get_future().share();
+  std::atomic_size_t ranges{0}, other_ranges{0};
+  EXPECT_CALL(*storage, getBlocks(_, kRange))
+      .WillRepeatedly(testing::Invoke([&](auto begin, auto count) {
+        other_requested_future.wait_for(std::chrono::seconds(5));
+        ++ranges;
+        return slice(blocks, begin, count);
+      }));
+  EXPECT_CALL(*other_storage, getBlocks(_, kRange))
+      .WillRepeatedly(testing::Invoke([&](auto begin, auto count) {
+        if (other_ranges++ == 0) {
+          other_requested.set_value();
+        }
+        return slice(blocks, begin, count);
+      }));
+
+  ASSERT_TRUE(retrieveAll(height, [](const auto &) {}));
+  EXPECT_LE(1, ranges);
+  EXPECT_LE(1, other_ranges);
+  EXPECT_EQ(4, ranges + other_ranges);
+}
+
+/**
+ * @given block loader and two peers, one of which sends only a part of the
+ * requested range
+ * @when retrieveBlocks is called for both peers
+ * @then the range is downloaded from the other peer
+ * @and the peer which failed is not asked anymore
+ */
+TEST_F(MultiPeerBlockLoaderTest, MovesFailedRangeToOtherPeer) {
+  const auto height = kTopHeight + 2 * kRange;
+  auto blocks = makeBlocks(height);
+
+  std::promise<void> other_requested;
+  auto other_requested_future = other_requested.get_future().share();
+  std::vector<shared_model::interface::types::HeightType> requested;
+  std::mutex requested_mutex;
+  EXPECT_CALL(*storage, getBlocks(_, kRange))
+      .WillRepeatedly(testing::Invoke([&](auto begin, auto count) {
+        other_requested_future.wait_for(std::chrono::seconds(5));
+        std::lock_guard<std::mutex> lock(requested_mutex);
+        requested.push_back(begin);
+        return slice(blocks, begin, count);
+      }));
+  shared_model::interface::types::HeightType failed_begin = 0;
+  EXPECT_CALL(*other_storage, getBlocks(_, kRange))
+      .WillOnce(testing::Invoke([&](auto begin, auto count) {
+        failed_begin = begin;
+        other_requested.set_value();
+        // stream ends before the last block of the range
+        return slice(blocks, begin, count - 1);
+      }));
+
+  ASSERT_TRUE(retrieveAll(height, [this](const auto &loaded) {
+    EXPECT_EQ(loaded.peer, peer_key);
+  }));
+  std::lock_guard<std::mutex> lock(requested_mutex);
+  EXPECT_EQ(2, requested.size());
+  EXPECT_NE(requested.end(),
+            std::find(requested.begin(), requested.end(), failed_begin));
+}
+
+/**
+ * @given block loader and two peers, one of which is not available
+ * @when retrieveBlocks is called for both peers
+ * @then all blocks are downloaded from the available peer
+ */
+TEST_F(MultiPeerBlockLoaderTest, SkipsUnavailablePeer) {
+  const auto height = kTopHeight + 2 * kRange;
+  auto blocks = makeBlocks(height);
+  other_server->Shutdown(std::chrono::system_clock::now());
+
+  EXPECT_CALL(*storage, getBlocks(_, kRange))
+      .Times(2)
+      .WillRepeatedly(testing::Invoke([&blocks](auto begin, auto count) {
+        return slice(blocks, begin, count);
+      }));
+  EXPECT_CALL(*other_storage, getBlocks(_, _)).Times(0);
+
+  ASSERT_TRUE(retrieveAll(height, [this](const auto &loaded) {
+    EXPECT_EQ(loaded.peer, peer_key);
+  }));
+}
+
+/**
+ * @given block loader and more missing blocks than it buffers
+ * @when the subscriber does not take the first block
+ * @then only ranges within the buffered window after the first block are
+ * requested
+ * @and the rest of blocks is requested when the subscriber takes blocks
+ */
+TEST_F(MultiPeerBlockLoaderTest, BuffersLimitedNumberOfBlocks) {
+  /// same as maximum number of blocks buffered by loader
+  const shared_model::interface::types::HeightType kWindow = 1024;
+  const auto height = kTopHeight + kWindow + 2 * kRange;
+  auto blocks = makeBlocks(height);
+
+  std::mutex requested_mutex;
+  std::condition_variable requested_cv;
+  std::vector<shared_model::interface::types::HeightType> requested;
+  auto serve = [&](auto begin, auto count) {
+    {
+      std::lock_guard<std::mutex> lock(requested_mutex);
+      requested.push_back(begin);
+    }
+    requested_cv.notify_all();
+    return slice(blocks, begin, count);
+  };
+  EXPECT_CALL(*storage, getBlocks(_, kRange))
+      .WillRepeatedly(testing::Invoke(serve));
+  EXPECT_CALL(*other_storage, getBlocks(_, kRange))
+      .WillRepeatedly(testing::Invoke(serve));
+
+  // while the first block is being taken, ranges which begin before the
+  // second block plus the window are requested
+  const size_t window_ranges = (kWindow + kRange) / kRange;
+  auto stalled = false;
+  ASSERT_TRUE(retrieveAll(height, [&](const auto &loaded) {
+    if (loaded.block->height() != kTopHeight + 1) {
+      return;
+    }
+    std::unique_lock<std::mutex> lock(requested_mutex);
+    stalled = requested_cv.wait_for(lock, std::chrono::seconds(5), [&] {
+      return requested.size() >= window_ranges;
+    });
+    // give the loader time to request more than it should
+    lock.unlock();
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    lock.lock();
+    EXPECT_EQ(window_ranges, requested.size());
+    for (auto begin : requested) {
+      EXPECT_LT(begin, kTopHeight + 2 + kWindow);
+    }
+  }));
+  ASSERT_TRUE(stalled);
+  std::lock_guard<std::mutex> lock(requested_mutex);
+  EXPECT_EQ((height - kTopHeight) / kRange, requested.size());
+}
+
+/**
+ * @given block loader and more missing blocks than it buffers
+ * @when the subscriber unsubscribes after the first block
+ * @then retrieval completes without requesting the rest of ranges
+ */
+TEST_F(MultiPeerBlockLoaderTest, StopsWhenUnsubscribed) {
+  /// same as maximum number of blocks buffered by loader
+  const shared_model::interface::types::HeightType kWindow = 1024;
+  const auto height = kTopHeight + kWindow + 2 * kRange;
+  auto blocks = makeBlocks(height);
+
+  std::atomic_size_t requested{0};
+  auto serve = [&](auto begin, auto count) {
+    ++requested;
+    return slice(blocks, begin, count);
+  };
+  EXPECT_CALL(*storage, getBlocks(_, kRange))
+      .WillRepeatedly(testing::Invoke(serve));
+  EXPECT_CALL(*other_storage, getBlocks(_, kRange))
+      .WillRepeatedly(testing::Invoke(serve));
+
+  auto wrapper = make_test_subscriber<CallExact>(
+      loader->retrieveBlocks({peer_key, other_peer_key}, height).take(1), 1);
+  wrapper.subscribe();
+
+  ASSERT_TRUE(wrapper.validate());
+  EXPECT_GT((height - kTopHeight) / kRange, requested);
+}
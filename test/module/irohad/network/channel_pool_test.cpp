@@ -0,0 +1,89 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <gtest/gtest.h>
+
+#include "builders/protobuf/common_objects/proto_peer_builder.hpp"
+#include "network/impl/channel_pool.hpp"
+
+using namespace iroha::network;
+
+class ChannelPoolTest : public testing::Test {
+ public:
+  auto makePeer(const std::string &address) {
+    return shared_model::proto::PeerBuilder()
+        .address(address)
+        .pubkey(shared_model::crypto::PublicKey(std::string(32, '1')))
+        .build();
+  }
+
+  const std::string address = "127.0.0.1:50051";
+  const std::string other_address = "127.0.0.1:50052";
+};
+
+/**
+ * @given channel pool
+ * @when channel to the same address is requested twice
+ * @then the same channel is returned, other address gets other channel
+ */
+TEST_F(ChannelPoolTest, SharesChannelOfAddress) {
+  ChannelPool pool;
+
+  auto channel = pool.channel(address);
+  ASSERT_EQ(channel, pool.channel(address));
+  ASSERT_NE(channel, pool.channel(other_address));
+  ASSERT_EQ(2, pool.size());
+}
+
+/**
+ * @given channel pool with channel to address
+ * @when calls through the channel fail several times in a row
+ * @then next request creates new channel, while errors returned by the peer
+ * itself do not affect the channel
+ */
+TEST_F(ChannelPoolTest, RecreatesUnhealthyChannel) {
+  ChannelPool pool;
+  auto channel = pool.channel(address);
+
+  for (size_t i = 0; i < ChannelPool::kMaxFailures; ++i) {
+    pool.report(address, grpc::Status(grpc::StatusCode::NOT_FOUND, ""));
+  }
+  ASSERT_EQ(channel, pool.channel(address));
+
+  for (size_t i = 0; i < ChannelPool::kMaxFailures; ++i) {
+    pool.report(address, grpc::Status(grpc::StatusCode::UNAVAILABLE, ""));
+  }
+  ASSERT_NE(channel, pool.channel(address));
+}
+
+/**
+ * @given channel pool with channel to peer
+ * @when the same peer is requested with another address
+ * @then channel to the old address is dropped
+ */
+TEST_F(ChannelPoolTest, InvalidatesChangedAddress) {
+  ChannelPool pool;
+
+  pool.channel(makePeer(address));
+  pool.channel(makePeer(other_address));
+
+  ASSERT_EQ(1, pool.size());
+}
+
+/**
+ * @given channel pool with zero idle timeout
+ * @when channels are requested
+ * @then channels which are not held by any client are dropped
+ */
+TEST_F(ChannelPoolTest, EvictsIdleChannels) {
+  ChannelPool pool(std::chrono::milliseconds(0));
+
+  auto channel = pool.channel(address);
+  pool.channel(other_address);
+  pool.channel(address);
+
+  ASSERT_EQ(1, pool.size());
+  ASSERT_EQ(channel, pool.channel(address));
+}
@@ -54,6 +54,8 @@ namespace iroha {
           on_verified_proposal,
           rxcpp::observable<
               std::shared_ptr<validation::VerifiedProposalAndErrors>>());
+
+      MOCK_CONST_METHOD0(on_rejection, rxcpp::observable<OrderingRejection>());
     };
 
     class MockBlockLoader : public BlockLoader {
@@ -62,11 +64,19 @@ namespace iroha {
           retrieveBlocks,
           rxcpp::observable<std::shared_ptr<shared_model::interface::Block>>(
               const shared_model::crypto::PublicKey &));
+      MOCK_METHOD2(
+          retrieveBlocks,
+          rxcpp::observable<LoadedBlock>(
+              const std::vector<shared_model::crypto::PublicKey> &,
+              shared_model::interface::types::HeightType));
       MOCK_METHOD2(
           retrieveBlock,
           boost::optional<std::shared_ptr<shared_model::interface::Block>>(
               const shared_model::crypto::PublicKey &,
               const shared_model::interface::types::HashType &));
+      MOCK_METHOD1(retrieveCheckpoint,
+                   boost::optional<Checkpoint>(
+                       const shared_model::interface::Peer &));
     };
 
     class MockOrderingGate : public OrderingGate {
@@ -84,6 +94,8 @@ namespace iroha {
                    rxcpp::observable<
                        std::shared_ptr<shared_model::interface::Proposal>>());
 
+      MOCK_METHOD0(on_rejection, rxcpp::observable<OrderingRejection>());
+
       MOCK_METHOD1(setPcs, void(const PeerCommunicationService &));
     };
 
@@ -35,6 +35,7 @@ using namespace framework::test_subscriber;
 using namespace std::chrono_literals;
 
 using ::testing::_;
+using ::testing::Invoke;
 using ::testing::InvokeWithoutArgs;
 using ::testing::Return;
 
@@ -47,6 +48,10 @@ class MockOrderingGateTransportGrpcService
                ::grpc::Status(::grpc::ServerContext *,
                               const iroha::protocol::Transaction *,
                               ::google::protobuf::Empty *));
+  MOCK_METHOD3(onBatches,
+               ::grpc::Status(::grpc::ServerContext *,
+                              const proto::BatchList *,
+                              proto::BatchesResponse *));
 };
 
 class MockOrderingGateTransport : public OrderingGateTransport {
@@ -75,7 +80,8 @@ class OrderingGateTest : public ::testing::Test {
     server = builder.BuildAndStart();
     auto address = "0.0.0.0:" + std::to_string(port);
     // Initialize components after port has been bind
-    transport = std::make_shared<OrderingGateTransportGrpc>(address);
+    transport = std::make_shared<OrderingGateTransportGrpc>(
+        address, std::make_shared<iroha::network::ChannelPool>());
     gate_impl = std::make_shared<OrderingGateImpl>(transport, 1, false);
     transport->subscribe(gate_impl);
 
@@ -99,14 +105,14 @@ class OrderingGateTest : public ::testing::Test {
 /**
  * @given Initialized OrderingGate
  * @when  Send 5 transactions to Ordering Gate
- * @then  Check that transactions are received
+ * @then  Check that transactions are received in batch lists
  */
 TEST_F(OrderingGateTest, TransactionReceivedByServerWhenSent) {
   size_t call_count = 0;
-  EXPECT_CALL(*fake_service, onTransaction(_, _, _))
-      .Times(5)
-      .WillRepeatedly(InvokeWithoutArgs([&] {
-        ++call_count;
+  EXPECT_CALL(*fake_service, onBatches(_, _, _))
+      .WillRepeatedly(Invoke([&](auto, const proto::BatchList *request, auto) {
+        std::lock_guard<std::mutex> lock(m);
+        call_count += request->batches_size();
         cv.notify_one();
         return grpc::Status::OK;
       }));
@@ -118,7 +124,38 @@ TEST_F(OrderingGateTest, TransactionReceivedByServerWhenSent) {
   }
 
   std::unique_lock<std::mutex> lock(m);
-  cv.wait_for(lock, 10s, [&] { return call_count == 5; });
+  ASSERT_TRUE(cv.wait_for(lock, 10s, [&] { return call_count == 5; }));
+}
+
+/**
+ * @given Initialized OrderingGate
+ * @when  Ordering service rejects the sent transaction
+ * @then  Hash of the transaction and size of the queue are emitted by the gate
+ */
+TEST_F(OrderingGateTest, RejectionReceivedWhenQueueIsFull) {
+  auto tx = std::make_shared<shared_model::proto::Transaction>(
+      TestTransactionBuilder().build());
+  EXPECT_CALL(*fake_service, onBatches(_, _, _))
+      .WillOnce(Invoke([&](auto, auto, proto::BatchesResponse *response) {
+        response->add_rejected_hashes(
+            shared_model::crypto::toBinaryString(tx->hash()));
+        response->set_queue_size(100);
+        return grpc::Status::OK;
+      }));
+
+  boost::optional<OrderingRejection> rejection;
+  gate_impl->on_rejection().subscribe([&](const auto &value) {
+    std::lock_guard<std::mutex> lock(m);
+    rejection = value;
+    cv.notify_one();
+  });
+  gate_impl->propagateTransaction(tx);
+
+  std::unique_lock<std::mutex> lock(m);
+  ASSERT_TRUE(cv.wait_for(lock, 10s, [&] { return bool(rejection); }));
+  ASSERT_EQ(std::vector<shared_model::crypto::Hash>{tx->hash()},
+            rejection->hashes);
+  ASSERT_EQ(100, rejection->queue_size);
 }
 
 /**
@@ -48,6 +48,10 @@ class MockOrderingServiceTransport : public network::OrderingServiceTransport {
                void(shared_model::interface::Proposal *proposal,
                     const std::vector<std::string> &peers));
 
+  MOCK_METHOD2(publishDropped,
+               void(const network::OrderingRejection &dropped,
+                    const std::vector<std::string> &peers));
+
   std::weak_ptr<network::OrderingServiceNotification> subscriber_;
 };
 
@@ -70,7 +74,7 @@ class OrderingServiceTest : public ::testing::Test {
         shared_model::validation::AlwaysValidValidator>>();
   }
 
-  auto initOs(size_t max_proposal) {
+  auto initOs(size_t max_proposal, QueueLimits limits = QueueLimits()) {
     return std::make_shared<OrderingServiceImpl>(
         wsv,
         max_proposal,
@@ -78,7 +82,26 @@ class OrderingServiceTest : public ::testing::Test {
         fake_transport,
         fake_persistent_state,
         std::move(factory),
-        false);
+        false,
+        limits);
+  }
+
+  /**
+   * Create batch of single transaction of given creator
+   * @param creator - creator of the transaction
+   * @param time_offset - makes transactions of the same creator differ
+   */
+  auto makeBatch(const std::string &creator, size_t time_offset = 0) {
+    return *framework::batch::makeTestBatch(
+        framework::batch::prepareTransactionBuilder(
+            creator, iroha::time::now() + time_offset));
+  }
+
+  /**
+   * @return hash of the only transaction of the batch
+   */
+  auto hashOf(const shared_model::interface::TransactionBatch &batch) {
+    return batch.transactions().front()->hash();
   }
 
   void makeProposalTimeout() {
@@ -127,14 +150,14 @@ TEST_F(OrderingServiceTest, SimpleTest) {
  *        and MockOrderingServicePersistentState
  * @when OrderingService::onTransaction called 10 times
  * @then publishProposalProxy called twice
- *       and proposal height was loaded once and saved twice
+ *       and proposal height was loaded once and its range was saved once
  */
 TEST_F(OrderingServiceTest, ValidWhenProposalSizeStrategy) {
   const size_t max_proposal = 5;
   const size_t tx_num = 10;
 
   EXPECT_CALL(*fake_persistent_state, saveProposalHeight(_))
-      .Times(2)
+      .Times(1)
       .WillRepeatedly(Return(true));
   EXPECT_CALL(*fake_persistent_state, loadProposalHeight())
       .Times(1)
@@ -148,10 +171,44 @@ TEST_F(OrderingServiceTest, ValidWhenProposalSizeStrategy) {
   fake_transport->subscribe(ordering_service);
 
   for (size_t i = 0; i < tx_num; ++i) {
-    ordering_service->onBatch(framework::batch::createValidBatch(1));
+    ordering_service->onBatch(
+        framework::batch::createValidBatch(1, iroha::time::now() + i));
   }
 }
 
+/**
+ * @given OrderingService with max_proposal==5 and only self peer
+ *        and MockOrderingServiceTransport
+ *        and MockOrderingServicePersistentState
+ * @when OrderingService::onBatches called once with 10 batches
+ * @then publishProposalProxy called twice
+ */
+TEST_F(OrderingServiceTest, ValidWhenBatchListReceived) {
+  const size_t max_proposal = 5;
+  const size_t tx_num = 10;
+
+  EXPECT_CALL(*fake_persistent_state, saveProposalHeight(_))
+      .Times(1)
+      .WillRepeatedly(Return(true));
+  EXPECT_CALL(*fake_persistent_state, loadProposalHeight())
+      .Times(1)
+      .WillOnce(Return(boost::optional<size_t>(2)));
+  EXPECT_CALL(*fake_transport, publishProposalProxy(_, _))
+      .Times(tx_num / max_proposal);
+  EXPECT_CALL(*wsv, getLedgerPeers())
+      .WillRepeatedly(Return(std::vector<decltype(peer)>{peer}));
+
+  auto ordering_service = initOs(max_proposal);
+  fake_transport->subscribe(ordering_service);
+
+  std::vector<shared_model::interface::TransactionBatch> batches;
+  for (size_t i = 0; i < tx_num; ++i) {
+    batches.push_back(
+        framework::batch::createValidBatch(1, iroha::time::now() + i));
+  }
+  ordering_service->onBatches(std::move(batches));
+}
+
 /**
  * @given OrderingService with big enough max_proposal and only self peer
  *        and MockOrderingServiceTransport
@@ -160,13 +217,13 @@ TEST_F(OrderingServiceTest, ValidWhenProposalSizeStrategy) {
  *       and after triggered timeout
  *       and then repeat with 2 onTransaction calls
  * @then publishProposalProxy called twice
- *       and proposal height was loaded once and saved twice
+ *       and proposal height was loaded once and its range was saved once
  */
 TEST_F(OrderingServiceTest, ValidWhenTimerStrategy) {
   const size_t max_proposal = 100;
 
   EXPECT_CALL(*fake_persistent_state, saveProposalHeight(_))
-      .Times(2)
+      .Times(1)
       .WillRepeatedly(Return(true));
   EXPECT_CALL(*fake_persistent_state, loadProposalHeight())
       .Times(1)
@@ -178,13 +235,14 @@ TEST_F(OrderingServiceTest, ValidWhenTimerStrategy) {
   auto ordering_service = initOs(max_proposal);
   fake_transport->subscribe(ordering_service);
 
+  auto now = iroha::time::now();
   for (size_t i = 0; i < 8; ++i) {
-    ordering_service->onBatch(framework::batch::createValidBatch(1));
+    ordering_service->onBatch(framework::batch::createValidBatch(1, now + i));
   }
   makeProposalTimeout();
 
-  ordering_service->onBatch(framework::batch::createValidBatch(1));
-  ordering_service->onBatch(framework::batch::createValidBatch(1));
+  ordering_service->onBatch(framework::batch::createValidBatch(1, now + 8));
+  ordering_service->onBatch(framework::batch::createValidBatch(1, now + 9));
 
   makeProposalTimeout();
 }
@@ -201,7 +259,8 @@ TEST_F(OrderingServiceTest, BrokenPersistentState) {
   EXPECT_CALL(*fake_persistent_state, loadProposalHeight())
       .Times(1)
       .WillOnce(Return(boost::optional<size_t>(1)));
-  EXPECT_CALL(*fake_persistent_state, saveProposalHeight(2))
+  EXPECT_CALL(*fake_persistent_state,
+              saveProposalHeight(1 + ProposalHeightAllocator::kDefaultRange))
       .Times(1)
       .WillRepeatedly(Return(false));
 
@@ -228,7 +287,8 @@ TEST_F(OrderingServiceTest, ConcurrentGenerateProposal) {
 
   auto on_tx = [&]() {
     for (int i = 0; i < 1000; ++i) {
-      ordering_service->onBatch(framework::batch::createValidBatch(1));
+      ordering_service->onBatch(
+          framework::batch::createValidBatch(1, iroha::time::now() + i));
     }
   };
 
@@ -283,7 +343,8 @@ TEST_F(OrderingServiceTest, GenerateProposalDestructor) {
       // create max_proposal+1 txs, so that publish proposal is invoked at least
       // once (concurrency!)
       for (int i = 0; i < max_proposal + 1; ++i) {
-        ordering_service.onBatch(framework::batch::createValidBatch(1));
+        ordering_service.onBatch(
+            framework::batch::createValidBatch(1, iroha::time::now() + i));
       }
     };
 
@@ -293,6 +354,218 @@ TEST_F(OrderingServiceTest, GenerateProposalDestructor) {
   EXPECT_CALL(*fake_transport, publishProposalProxy(_, _)).Times(0);
 }
 
+/**
+ * @given OrderingService with queue capacity of 2 transactions and reject
+ * policy
+ * @when 3 batches are received
+ * @then the last batch is rejected and the queue holds 2 transactions
+ */
+TEST_F(OrderingServiceTest, RejectsBatchWhenQueueIsFull) {
+  EXPECT_CALL(*fake_persistent_state, loadProposalHeight())
+      .WillOnce(Return(boost::optional<size_t>(2)));
+  EXPECT_CALL(*fake_transport, publishProposalProxy(_, _)).Times(0);
+
+  auto ordering_service = initOs(10, {2, QueuePolicy::kReject});
+  std::vector<shared_model::interface::TransactionBatch> batches = {
+      makeBatch("a@domain", 0), makeBatch("a@domain", 1)};
+  auto rejected = makeBatch("a@domain", 2);
+  batches.push_back(rejected);
+
+  auto admission = ordering_service->onBatches(std::move(batches));
+
+  ASSERT_EQ(std::vector<shared_model::crypto::Hash>{hashOf(rejected)},
+            admission.rejected);
+  ASSERT_EQ(2, admission.queue_size);
+}
+
+/**
+ * @given OrderingService with queue capacity of 2 transactions and drop
+ * oldest policy
+ * @when 3 batches are received
+ * @then the first batch is dropped and the queue holds 2 transactions
+ * AND the dropped transaction is published to all the peers instead of being
+ * rejected in reply to the sender
+ */
+TEST_F(OrderingServiceTest, DropsOldestBatchWhenQueueIsFull) {
+  EXPECT_CALL(*fake_persistent_state, loadProposalHeight())
+      .WillOnce(Return(boost::optional<size_t>(2)));
+  EXPECT_CALL(*fake_transport, publishProposalProxy(_, _)).Times(0);
+  EXPECT_CALL(*wsv, getLedgerPeers())
+      .WillRepeatedly(Return(std::vector<decltype(peer)>{peer}));
+
+  auto ordering_service = initOs(10, {2, QueuePolicy::kDropOldest});
+  auto dropped = makeBatch("a@domain", 0);
+  std::vector<shared_model::interface::TransactionBatch> batches = {
+      dropped, makeBatch("a@domain", 1), makeBatch("a@domain", 2)};
+
+  EXPECT_CALL(*fake_transport,
+              publishDropped(_, std::vector<std::string>{address}))
+      .WillOnce(Invoke([&](const auto &rejection, const auto &) {
+        ASSERT_EQ(std::vector<shared_model::crypto::Hash>{hashOf(dropped)},
+                  rejection.hashes);
+        ASSERT_EQ(2, rejection.queue_size);
+      }));
+
+  auto admission = ordering_service->onBatches(std::move(batches));
+
+  ASSERT_TRUE(admission.rejected.empty());
+  ASSERT_EQ(2, admission.queue_size);
+}
+
+/**
+ * @given OrderingService with queue capacity of 4 transactions and fair share
+ * policy
+ * @when two creators send batches and one of them exceeds half of the queue
+ * @then batch of that creator is rejected although the queue is not full
+ */
+TEST_F(OrderingServiceTest, RejectsBatchOverFairShare) {
+  EXPECT_CALL(*fake_persistent_state, loadProposalHeight())
+      .WillOnce(Return(boost::optional<size_t>(2)));
+  EXPECT_CALL(*fake_transport, publishProposalProxy(_, _)).Times(0);
+
+  auto ordering_service = initOs(10, {4, QueuePolicy::kFairShare});
+  auto rejected = makeBatch("a@domain", 2);
+  std::vector<shared_model::interface::TransactionBatch> batches = {
+      makeBatch("a@domain", 0),
+      makeBatch("a@domain", 1),
+      makeBatch("b@domain", 0),
+      rejected};
+
+  auto admission = ordering_service->onBatches(std::move(batches));
+
+  ASSERT_EQ(std::vector<shared_model::crypto::Hash>{hashOf(rejected)},
+            admission.rejected);
+  ASSERT_EQ(3, admission.queue_size);
+}
+
+/**
+ * @given OrderingService
+ * @when the same batch is received twice in one list and once more later
+ * @then it is enqueued once and its copies are counted as suppressed
+ */
+TEST_F(OrderingServiceTest, DropsDuplicateBatch) {
+  EXPECT_CALL(*fake_persistent_state, loadProposalHeight())
+      .WillOnce(Return(boost::optional<size_t>(2)));
+  EXPECT_CALL(*fake_transport, publishProposalProxy(_, _)).Times(0);
+
+  auto ordering_service = initOs(10);
+  auto batch = makeBatch("a@domain");
+
+  auto admission = ordering_service->onBatches({batch, batch});
+  ordering_service->onBatch(std::move(batch));
+
+  ASSERT_TRUE(admission.rejected.empty());
+  ASSERT_EQ(1, admission.queue_size);
+  ASSERT_EQ(2, ordering_service->suppressedDuplicates());
+}
+
+/**
+ * @given OrderingService with max_proposal==1
+ * @when a batch is proposed and then received again
+ * @then the copy is dropped and no other proposal is published
+ */
+TEST_F(OrderingServiceTest, DropsDuplicateOfProposedBatch) {
+  EXPECT_CALL(*fake_persistent_state, loadProposalHeight())
+      .WillOnce(Return(boost::optional<size_t>(2)));
+  EXPECT_CALL(*fake_persistent_state, saveProposalHeight(_))
+      .WillOnce(Return(true));
+  EXPECT_CALL(*fake_transport, publishProposalProxy(_, _)).Times(1);
+  EXPECT_CALL(*wsv, getLedgerPeers())
+      .WillRepeatedly(Return(std::vector<decltype(peer)>{peer}));
+
+  auto ordering_service = initOs(1);
+  fake_transport->subscribe(ordering_service);
+  auto batch = makeBatch("a@domain");
+  auto copy = batch;
+
+  ordering_service->onBatch(std::move(batch));
+  ordering_service->onBatch(std::move(copy));
+  makeProposalTimeout();
+
+  ASSERT_EQ(1, ordering_service->suppressedDuplicates());
+}
+
+/**
+ * @given OrderingService with max_proposal==100 and controller which keeps
+ * proposal size of 2
+ * @when 2 batches are received
+ * @then proposal is published without timeout
+ */
+TEST_F(OrderingServiceTest, UsesProposalSizeOfController) {
+  EXPECT_CALL(*fake_persistent_state, loadProposalHeight())
+      .WillOnce(Return(boost::optional<size_t>(2)));
+  EXPECT_CALL(*fake_persistent_state, saveProposalHeight(_))
+      .WillOnce(Return(true));
+  EXPECT_CALL(*fake_transport, publishProposalProxy(_, _)).Times(1);
+  EXPECT_CALL(*wsv, getLedgerPeers())
+      .WillRepeatedly(Return(std::vector<decltype(peer)>{peer}));
+
+  ProposalBounds bounds;
+  bounds.min_size = 2;
+  bounds.max_size = 2;
+  auto ordering_service = std::make_shared<OrderingServiceImpl>(
+      wsv,
+      100,
+      proposal_timeout.get_observable(),
+      fake_transport,
+      fake_persistent_state,
+      std::move(factory),
+      false,
+      QueueLimits(),
+      OrderingServiceImpl::kDefaultDuplicateWindow,
+      ProposalHeightAllocator::kDefaultRange,
+      std::make_shared<ProposalController>(bounds));
+  fake_transport->subscribe(ordering_service);
+
+  ordering_service->onBatch(makeBatch("a@domain"));
+  ordering_service->onBatch(makeBatch("b@domain"));
+}
+
+/**
+ * @given OrderingService with max_proposal==4
+ * @when one creator sends 8 batches and then another creator of other lane
+ * sends a batch
+ * @then transaction of the second creator is in the first proposal
+ */
+TEST_F(OrderingServiceTest, LanesShareProposal) {
+  const std::string heavy = "heavy@domain";
+  std::string light;
+  for (size_t i = 0; light.empty(); ++i) {
+    auto candidate = "light" + std::to_string(i) + "@domain";
+    if (OrderingServiceImpl::laneIndex(candidate)
+        != OrderingServiceImpl::laneIndex(heavy)) {
+      light = candidate;
+    }
+  }
+
+  std::vector<std::string> creators;
+  EXPECT_CALL(*fake_persistent_state, loadProposalHeight())
+      .WillOnce(Return(boost::optional<size_t>(2)));
+  EXPECT_CALL(*fake_persistent_state, saveProposalHeight(_))
+      .WillOnce(Return(true));
+  EXPECT_CALL(*fake_transport, publishProposalProxy(_, _))
+      .WillOnce(Invoke([&creators](auto proposal, auto &) {
+        for (const auto &tx : proposal->transactions()) {
+          creators.push_back(tx.creatorAccountId());
+        }
+      }))
+      .WillRepeatedly(Return());
+  EXPECT_CALL(*wsv, getLedgerPeers())
+      .WillRepeatedly(Return(std::vector<decltype(peer)>{peer}));
+
+  auto ordering_service = initOs(4);
+  fake_transport->subscribe(ordering_service);
+  std::vector<shared_model::interface::TransactionBatch> batches;
+  for (size_t i = 0; i < 8; ++i) {
+    batches.push_back(makeBatch(heavy, i));
+  }
+  batches.push_back(makeBatch(light));
+  ordering_service->onBatches(std::move(batches));
+
+  ASSERT_EQ(4, creators.size());
+  ASSERT_EQ(1, std::count(creators.begin(), creators.end(), light));
+}
+
 /**
  * Check that batches are processed by ordering service
  * @given ordering service up and running
@@ -327,3 +600,52 @@ TEST_F(OrderingServiceTest, BatchesProceed) {
   ordering_service->onBatch(std::move(batch_one));
   ordering_service->onBatch(std::move(batch_two));
 }
+
+/**
+ * @given OrderingService restarted with proposal heights reserved up to 100
+ * AND ledger of 5 blocks
+ * @when proposals are generated with commits between some of them
+ * @then proposal heights continue from the top block and follow the commits
+ * AND heights of proposals ahead of the ledger are not reused
+ */
+TEST_F(OrderingServiceTest, AlignsProposalHeightsToLedger) {
+  EXPECT_CALL(*fake_persistent_state, loadProposalHeight())
+      .WillOnce(Return(boost::optional<size_t>(100)));
+  EXPECT_CALL(*fake_persistent_state, saveProposalHeight(_))
+      .WillRepeatedly(Return(true));
+  std::vector<shared_model::interface::types::HeightType> heights;
+  EXPECT_CALL(*fake_transport, publishProposalProxy(_, _))
+      .WillRepeatedly(Invoke([&heights](auto proposal, auto &) {
+        heights.push_back(proposal->height());
+      }));
+  EXPECT_CALL(*wsv, getLedgerPeers())
+      .WillRepeatedly(Return(std::vector<decltype(peer)>{peer}));
+
+  rxcpp::subjects::subject<shared_model::interface::types::HeightType> ledger;
+  auto ordering_service = std::make_shared<OrderingServiceImpl>(
+      wsv,
+      1,
+      proposal_timeout.get_observable(),
+      fake_transport,
+      fake_persistent_state,
+      std::move(factory),
+      false,
+      QueueLimits(),
+      OrderingServiceImpl::kDefaultDuplicateWindow,
+      ProposalHeightAllocator::kDefaultRange,
+      nullptr,
+      ledger.get_observable());
+  fake_transport->subscribe(ordering_service);
+
+  ledger.get_subscriber().on_next(5);
+  ordering_service->onBatch(makeBatch("a@domain"));
+  ledger.get_subscriber().on_next(6);
+  ordering_service->onBatch(makeBatch("b@domain"));
+  ordering_service->onBatch(makeBatch("c@domain"));
+  ledger.get_subscriber().on_next(7);
+  ordering_service->onBatch(makeBatch("d@domain"));
+
+  ASSERT_EQ(
+      std::vector<shared_model::interface::types::HeightType>({6, 7, 8, 9}),
+      heights);
+}
@@ -0,0 +1,113 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <gtest/gtest.h>
+
+#include "ordering/impl/proposal_controller.hpp"
+
+using namespace iroha::ordering;
+using namespace iroha::metrics;
+using namespace std::chrono_literals;
+
+class ProposalControllerTest : public ::testing::Test {
+ public:
+  void SetUp() override {
+    bounds.min_size = 1;
+    bounds.max_size = 5000;
+    bounds.min_delay = 10ms;
+    bounds.max_delay = 5000ms;
+    bounds.latency_target = 1000ms;
+  }
+
+  /**
+   * Record a round which spent given time in validation and commit
+   */
+  void process(std::chrono::microseconds duration) {
+    metrics.record(Phase::kValidation, ++height, duration / 2);
+    metrics.record(Phase::kCommit, height, duration / 2);
+  }
+
+  ProposalBounds bounds;
+  RoundMetrics metrics;
+  uint64_t height = 0;
+};
+
+/**
+ * @given bounds of proposal
+ * @when there is no load
+ * @then proposal is of the minimum size, so transaction is proposed as soon
+ * as it arrives
+ */
+TEST_F(ProposalControllerTest, MinimumSizeWhenIdle) {
+  auto tuning = ProposalController::tune(bounds, 0, 0us);
+
+  ASSERT_EQ(1, tuning.size);
+  ASSERT_EQ(1000ms, tuning.delay);
+}
+
+/**
+ * @given bounds of proposal
+ * @when load is high and processing time is unknown
+ * @then proposal holds transactions of the whole latency target up to the
+ * maximum size
+ */
+TEST_F(ProposalControllerTest, MaximumSizeWhenLoaded) {
+  auto tuning = ProposalController::tune(bounds, 10000, 0us);
+
+  ASSERT_EQ(5000, tuning.size);
+  ASSERT_EQ(1000ms, tuning.delay);
+}
+
+/**
+ * @given bounds of proposal
+ * @when processing of arrived transactions takes as much time as their
+ * arrival
+ * @then half of the latency target is spent waiting for the proposal and half
+ * processing it
+ */
+TEST_F(ProposalControllerTest, SplitsTargetBetweenDelayAndProcessing) {
+  auto tuning = ProposalController::tune(bounds, 1000, 1000us);
+
+  ASSERT_EQ(500, tuning.size);
+  ASSERT_EQ(500ms, tuning.delay);
+}
+
+/**
+ * @given bounds of proposal with high minimum delay
+ * @when processing of transactions is expensive
+ * @then proposal is limited to the size processed within the rest of the
+ * latency target
+ */
+TEST_F(ProposalControllerTest, LimitsSizeByProcessingTime) {
+  bounds.min_delay = 800ms;
+
+  auto tuning = ProposalController::tune(bounds, 1000, 1000us);
+
+  ASSERT_EQ(200, tuning.size);
+  ASSERT_EQ(800ms, tuning.delay);
+}
+
+/**
+ * @given controller
+ * @when transactions arrive, and then their processing becomes slow
+ * @then proposal size grows with the arrival rate, and shrinks with the
+ * processing time
+ */
+TEST_F(ProposalControllerTest, AdaptsToMeasuredLoad) {
+  ProposalController controller(bounds, metrics);
+  auto now = ProposalController::Clock::now();
+  ASSERT_EQ(bounds.min_size, controller.size());
+
+  controller.onArrival(1000);
+  controller.onProposal(100, now + 1s);
+  auto loaded_size = controller.size();
+  ASSERT_LT(bounds.min_size, loaded_size);
+
+  process(1s);
+  controller.onArrival(1000);
+  controller.onProposal(100, now + 2s);
+  ASSERT_GT(loaded_size, controller.size());
+  ASSERT_GT(1000ms, controller.delay());
+}
@@ -0,0 +1,159 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "module/irohad/ordering/mock_ordering_service_persistent_state.hpp"
+#include "ordering/impl/proposal_height_allocator.hpp"
+
+using namespace iroha::ordering;
+
+using ::testing::_;
+using ::testing::Invoke;
+using ::testing::InSequence;
+using ::testing::Return;
+
+class ProposalHeightAllocatorTest : public ::testing::Test {
+ public:
+  void SetUp() override {
+    persistent_state = std::make_shared<MockOrderingServicePersistentState>();
+  }
+
+  /**
+   * Make persistent state keep the saved height in memory
+   */
+  void keepHeight(size_t height) {
+    stored = height;
+    ON_CALL(*persistent_state, loadProposalHeight())
+        .WillByDefault(Invoke([this] { return boost::make_optional(stored); }));
+    ON_CALL(*persistent_state, saveProposalHeight(_))
+        .WillByDefault(Invoke([this](size_t height) {
+          stored = height;
+          return true;
+        }));
+  }
+
+  std::shared_ptr<MockOrderingServicePersistentState> persistent_state;
+  size_t stored = 0;
+};
+
+/**
+ * @given allocator with range of 10 heights
+ * @when 3 heights are taken
+ * @then they are consecutive and the range is saved once
+ */
+TEST_F(ProposalHeightAllocatorTest, ReservesRangeOnce) {
+  EXPECT_CALL(*persistent_state, loadProposalHeight())
+      .WillOnce(Return(boost::optional<size_t>(5)));
+  EXPECT_CALL(*persistent_state, saveProposalHeight(15))
+      .WillOnce(Return(true));
+
+  ProposalHeightAllocator allocator(persistent_state, 10);
+
+  ASSERT_EQ(5, *allocator.next());
+  ASSERT_EQ(6, *allocator.next());
+  ASSERT_EQ(7, *allocator.next());
+}
+
+/**
+ * @given allocator with range of 4 heights
+ * @when half of the range is used
+ * @then the next range is reserved, and heights stay consecutive across ranges
+ */
+TEST_F(ProposalHeightAllocatorTest, ReservesNextRangeInAdvance) {
+  EXPECT_CALL(*persistent_state, loadProposalHeight())
+      .WillOnce(Return(boost::optional<size_t>(1)));
+  {
+    InSequence sequence;
+    EXPECT_CALL(*persistent_state, saveProposalHeight(5))
+        .WillOnce(Return(true));
+    EXPECT_CALL(*persistent_state, saveProposalHeight(9))
+        .WillOnce(Return(true));
+  }
+
+  ProposalHeightAllocator allocator(persistent_state, 4);
+
+  for (size_t height = 1; height <= 5; ++height) {
+    ASSERT_EQ(height, *allocator.next());
+  }
+}
+
+/**
+ * @given allocator with persistent state which cannot save height
+ * @when height is taken twice, the second time the state is repaired
+ * @then no height is returned the first time, and the same height is
+ * returned the second time
+ */
+TEST_F(ProposalHeightAllocatorTest, DoesNotTakeHeightWhenSaveFails) {
+  EXPECT_CALL(*persistent_state, loadProposalHeight())
+      .WillOnce(Return(boost::optional<size_t>(3)));
+  EXPECT_CALL(*persistent_state, saveProposalHeight(13))
+      .WillOnce(Return(false))
+      .WillOnce(Return(true));
+
+  ProposalHeightAllocator allocator(persistent_state, 10);
+
+  ASSERT_FALSE(allocator.next());
+  ASSERT_EQ(3, *allocator.next());
+}
+
+/**
+ * @given allocator which has taken some heights
+ * @when allocator is recreated from the same persistent state
+ * @then heights taken by the new allocator are greater than the old ones
+ */
+TEST_F(ProposalHeightAllocatorTest, DoesNotReuseHeightsAfterRestart) {
+  keepHeight(1);
+
+  size_t last = 0;
+  {
+    ProposalHeightAllocator allocator(persistent_state, 4);
+    for (size_t i = 0; i < 6; ++i) {
+      last = *allocator.next();
+    }
+  }
+
+  ProposalHeightAllocator allocator(persistent_state, 4);
+  ASSERT_LT(last, *allocator.next());
+}
+
+/**
+ * @given allocator restarted with heights reserved far above the ledger
+ * @when it is aligned to the next block before any height is taken
+ * @then heights continue from the next block without writing the storage
+ */
+TEST_F(ProposalHeightAllocatorTest, AlignsToLedgerAfterRestart) {
+  EXPECT_CALL(*persistent_state, loadProposalHeight())
+      .WillOnce(Return(boost::optional<size_t>(100)));
+  EXPECT_CALL(*persistent_state, saveProposalHeight(_)).Times(0);
+
+  ProposalHeightAllocator allocator(persistent_state, 10);
+  allocator.align(6);
+
+  ASSERT_EQ(6, *allocator.next());
+  ASSERT_EQ(7, *allocator.next());
+}
+
+/**
+ * @given allocator which has taken some heights
+ * @when it is aligned to a height which is already taken, and then to a
+ * greater one
+ * @then taken heights are not reused, and heights continue from the greater
+ * one
+ */
+TEST_F(ProposalHeightAllocatorTest, DoesNotReuseTakenHeightsOnAlign) {
+  keepHeight(5);
+
+  ProposalHeightAllocator allocator(persistent_state, 10);
+  ASSERT_EQ(5, *allocator.next());
+  ASSERT_EQ(6, *allocator.next());
+
+  allocator.align(6);
+  ASSERT_EQ(7, *allocator.next());
+
+  allocator.align(9);
+  ASSERT_EQ(9, *allocator.next());
+}
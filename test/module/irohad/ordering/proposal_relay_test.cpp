@@ -0,0 +1,265 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <condition_variable>
+
+#include <grpc++/grpc++.h>
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "backend/protobuf/common_objects/peer.hpp"
+#include "builders/protobuf/common_objects/proto_peer_builder.hpp"
+#include "builders/protobuf/proposal.hpp"
+#include "builders/protobuf/transaction.hpp"
+#include "cryptography/crypto_provider/crypto_defaults.hpp"
+#include "datetime/time.hpp"
+#include "module/irohad/ametsuchi/ametsuchi_mocks.hpp"
+#include "ordering/impl/ordering_gate_transport_grpc.hpp"
+#include "ordering/impl/proposal_relay.hpp"
+
+using namespace iroha;
+using namespace iroha::ordering;
+using namespace iroha::network;
+using namespace std::chrono_literals;
+
+using ::testing::_;
+using ::testing::Invoke;
+using ::testing::InvokeWithoutArgs;
+
+class MockOrderingGateNotification : public OrderingGateNotification {
+ public:
+  MOCK_METHOD1(onProposal,
+               void(std::shared_ptr<shared_model::interface::Proposal>));
+};
+
+class ProposalRelayTest : public ::testing::Test {
+ public:
+  void SetUp() override {
+    auto tx = shared_model::proto::TransactionBuilder()
+                  .createdTime(iroha::time::now())
+                  .creatorAccountId("admin@ru")
+                  .addAssetQuantity("coin#coin", "1.0")
+                  .quorum(1)
+                  .build()
+                  .signAndAddSignature(
+                      shared_model::crypto::DefaultCryptoAlgorithmType::
+                          generateKeypair())
+                  .finish();
+    std::vector<shared_model::proto::Transaction> txs = {tx};
+    proposal = shared_model::proto::ProposalBuilder()
+                   .height(2)
+                   .createdTime(iroha::time::now())
+                   .transactions(txs)
+                   .build()
+                   .getTransport();
+
+    ON_CALL(*peer_query, getLedgerPeers()).WillByDefault(Invoke([this] {
+      std::lock_guard<std::mutex> lock(mutex);
+      return boost::make_optional(ledger_peers);
+    }));
+  }
+
+  /**
+   * Make the peer with given address a ledger peer
+   */
+  void addLedgerPeer(const std::string &address) {
+    std::lock_guard<std::mutex> lock(mutex);
+    ledger_peers.push_back(clone(shared_model::proto::PeerBuilder()
+                                     .address(address)
+                                     .pubkey(shared_model::crypto::PublicKey(
+                                         std::string(32, '0')))
+                                     .build()));
+  }
+
+  /**
+   * Start gate transport which counts received proposals, proposals are
+   * handled while they are not held
+   * @param ledger_peer - whether the gate is a ledger peer, otherwise it
+   * must not receive proposals
+   * @return address of the transport
+   */
+  std::string startGate(bool ledger_peer = true) {
+    auto notification = std::make_shared<MockOrderingGateNotification>();
+    if (ledger_peer) {
+      EXPECT_CALL(*notification, onProposal(_))
+          .WillOnce(InvokeWithoutArgs([this] {
+            std::unique_lock<std::mutex> lock(mutex);
+            cv.wait(lock, [this] { return not held; });
+            ++received;
+            cv.notify_all();
+          }));
+    } else {
+      EXPECT_CALL(*notification, onProposal(_)).Times(0);
+    }
+    auto transport = std::make_shared<OrderingGateTransportGrpc>(
+        "0.0.0.0:0", channels, peer_query);
+    transport->subscribe(notification);
+
+    grpc::ServerBuilder builder;
+    int port = 0;
+    builder.AddListeningPort(
+        "0.0.0.0:0", grpc::InsecureServerCredentials(), &port);
+    builder.RegisterService(transport.get());
+    servers.push_back(builder.BuildAndStart());
+    EXPECT_NE(0, port);
+
+    notifications.push_back(notification);
+    transports.push_back(transport);
+    auto address = "0.0.0.0:" + std::to_string(port);
+    if (ledger_peer) {
+      addLedgerPeer(address);
+    }
+    return address;
+  }
+
+  /**
+   * Let gates handle proposals
+   */
+  void release() {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      held = false;
+    }
+    cv.notify_all();
+  }
+
+  void TearDown() override {
+    release();
+    for (auto &server : servers) {
+      server->Shutdown();
+    }
+  }
+
+  protocol::Proposal proposal;
+  std::shared_ptr<ChannelPool> channels = std::make_shared<ChannelPool>();
+  std::shared_ptr<ametsuchi::MockPeerQuery> peer_query =
+      std::make_shared<ametsuchi::MockPeerQuery>();
+  std::vector<std::shared_ptr<shared_model::interface::Peer>> ledger_peers;
+
+  std::vector<std::shared_ptr<MockOrderingGateNotification>> notifications;
+  std::vector<std::shared_ptr<OrderingGateTransportGrpc>> transports;
+  std::vector<std::unique_ptr<grpc::Server>> servers;
+
+  std::mutex mutex;
+  std::condition_variable cv;
+  size_t received = 0;
+  bool held = false;
+};
+
+/**
+ * @given list of 7 peers
+ * @when it is split with fanout 3
+ * @then subtrees have 3, 2 and 2 peers in original order
+ */
+TEST_F(ProposalRelayTest, SplitsPeersEvenly) {
+  std::vector<std::string> peers = {"1", "2", "3", "4", "5", "6", "7"};
+
+  auto subtrees = ProposalRelay::split(peers, 3);
+
+  ASSERT_EQ(3, subtrees.size());
+  ASSERT_EQ((std::vector<std::string>{"1", "2", "3"}), subtrees[0]);
+  ASSERT_EQ((std::vector<std::string>{"4", "5"}), subtrees[1]);
+  ASSERT_EQ((std::vector<std::string>{"6", "7"}), subtrees[2]);
+}
+
+/**
+ * @given list of 2 peers
+ * @when it is split with fanout 3
+ * @then every peer is a subtree of its own and no empty subtree is created
+ */
+TEST_F(ProposalRelayTest, SplitsFewPeers) {
+  auto subtrees = ProposalRelay::split({"1", "2"}, 3);
+
+  ASSERT_EQ(2, subtrees.size());
+}
+
+/**
+ * @given proposal relay
+ * @when the same proposal is accepted twice
+ * @then it is accepted only the first time, other proposal of the same height
+ * is accepted
+ */
+TEST_F(ProposalRelayTest, DropsDuplicateProposal) {
+  ProposalRelay relay(channels);
+
+  ASSERT_TRUE(relay.accept(proposal));
+  ASSERT_FALSE(relay.accept(proposal));
+
+  proposal.set_created_time(proposal.created_time() + 1);
+  ASSERT_TRUE(relay.accept(proposal));
+}
+
+/**
+ * @given three gate transports
+ * @when proposal is relayed to them with fanout 1
+ * @then every gate receives the proposal exactly once
+ */
+TEST_F(ProposalRelayTest, RelaysAlongChain) {
+  std::vector<std::string> peers = {startGate(), startGate(), startGate()};
+  ProposalRelay relay(channels);
+
+  relay.relay(proposal, peers, 1);
+
+  std::unique_lock<std::mutex> lock(mutex);
+  ASSERT_TRUE(cv.wait_for(lock, 10s, [this] { return received == 3; }));
+}
+
+/**
+ * @given two gate transports and an address where nobody listens
+ * @when proposal is relayed with the dead peer as the root of the tree
+ * @then proposal is delivered to the rest of the subtree by the sender
+ */
+TEST_F(ProposalRelayTest, BypassesFailedRoot) {
+  addLedgerPeer("127.0.0.1:1");
+  std::vector<std::string> peers = {"127.0.0.1:1", startGate(), startGate()};
+  ProposalRelay relay(channels);
+
+  relay.relay(proposal, peers, 1);
+
+  std::unique_lock<std::mutex> lock(mutex);
+  ASSERT_TRUE(cv.wait_for(lock, 10s, [this] { return received == 2; }));
+}
+
+/**
+ * @given gate transport which holds received proposals
+ * @when proposal is relayed to it with a short deadline
+ * @then the gate replies before the proposal is handled
+ */
+TEST_F(ProposalRelayTest, RepliesBeforeProposalIsHandled) {
+  held = true;
+  auto address = startGate();
+
+  proto::RelayedProposal request;
+  *request.mutable_proposal() = proposal;
+  request.set_fanout(1);
+  grpc::ClientContext context;
+  context.set_deadline(std::chrono::system_clock::now() + 1s);
+  google::protobuf::Empty response;
+  auto status = proto::OrderingGateTransportGrpc::NewStub(
+                    grpc::CreateChannel(address,
+                                        grpc::InsecureChannelCredentials()))
+                    ->onRelayedProposal(&context, request, &response);
+  ASSERT_TRUE(status.ok());
+
+  release();
+  std::unique_lock<std::mutex> lock(mutex);
+  ASSERT_TRUE(cv.wait_for(lock, 10s, [this] { return received == 1; }));
+}
+
+/**
+ * @given two gate transports, only the first of which is a ledger peer
+ * @when proposal is relayed with the subtree which contains the second one
+ * @then the first gate receives the proposal and does not forward it
+ */
+TEST_F(ProposalRelayTest, DoesNotForwardToUnknownPeers) {
+  std::vector<std::string> peers = {startGate(), startGate(false)};
+  ProposalRelay relay(channels);
+
+  relay.relay(proposal, peers, 1);
+
+  std::unique_lock<std::mutex> lock(mutex);
+  ASSERT_TRUE(cv.wait_for(lock, 10s, [this] { return received == 1; }));
+  ASSERT_FALSE(cv.wait_for(lock, 500ms, [this] { return received > 1; }));
+}
@@ -0,0 +1,244 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <gmock/gmock.h>
+
+#include "backend/protobuf/block.hpp"
+#include "builders/protobuf/common_objects/proto_peer_builder.hpp"
+#include "consensus/yac/impl/supermajority_checker_impl.hpp"
+#include "cryptography/crypto_provider/crypto_defaults.hpp"
+#include "datetime/time.hpp"
+#include "module/irohad/ametsuchi/ametsuchi_mocks.hpp"
+#include "module/irohad/network/network_mocks.hpp"
+#include "module/shared_model/builders/protobuf/test_block_builder.hpp"
+#include "module/shared_model/builders/protobuf/test_transaction_builder.hpp"
+#include "synchronizer/impl/fast_sync.hpp"
+
+using namespace iroha;
+using namespace iroha::ametsuchi;
+using namespace iroha::network;
+using namespace iroha::synchronizer;
+
+using ::testing::_;
+using ::testing::Field;
+using ::testing::Property;
+using ::testing::Return;
+using ::testing::SizeIs;
+
+using wBlock = std::shared_ptr<shared_model::interface::Block>;
+using wPeer = std::shared_ptr<shared_model::interface::Peer>;
+
+class FastSyncTest : public ::testing::Test {
+ public:
+  void SetUp() override {
+    block_loader = std::make_shared<MockBlockLoader>();
+    storage = std::make_shared<MockStorage>();
+    block_query = std::make_shared<MockBlockQuery>();
+    peer_query = std::make_shared<MockPeerQuery>();
+
+    for (size_t i = 0; i < kPeers; ++i) {
+      keys.push_back(
+          shared_model::crypto::DefaultCryptoAlgorithmType::generateKeypair());
+      peers.push_back(std::make_shared<shared_model::proto::Peer>(
+          shared_model::proto::PeerBuilder()
+              .address("127.0.0.1:" + std::to_string(10001 + i))
+              .pubkey(keys.back().publicKey())
+              .build()));
+    }
+
+    genesis = makeBlock(1, shared_model::crypto::Hash(std::string(32, '0')));
+    for (auto height = 2; height <= kHeight; ++height) {
+      blocks.push_back(makeBlock(
+          height, blocks.empty() ? genesis->hash() : blocks.back()->hash()));
+    }
+
+    EXPECT_CALL(*peer_query, getLedgerPeers()).WillRepeatedly(Return(peers));
+    EXPECT_CALL(*storage, getBlockQuery()).WillRepeatedly(Return(block_query));
+    EXPECT_CALL(*block_query, getTopBlock())
+        .WillRepeatedly(Return(expected::makeValue(wBlock(genesis))));
+
+    fast_sync = std::make_shared<FastSync>(
+        block_loader,
+        storage,
+        peer_query,
+        std::make_shared<consensus::yac::SupermajorityCheckerImpl>());
+  }
+
+  /**
+   * Make block signed by the first peers, all except the last one by default
+   * @param signers - number of peers which sign the block
+   * @param transactions - transactions of the block
+   */
+  wBlock makeBlock(
+      shared_model::interface::types::HeightType height,
+      const shared_model::crypto::Hash &prev_hash,
+      size_t signers = kPeers - 1,
+      std::vector<shared_model::proto::Transaction> transactions = {}) {
+    using TestUnsignedBlockBuilder = shared_model::proto::TemplateBlockBuilder<
+        (1 << shared_model::proto::TemplateBlockBuilder<>::total) - 1,
+        shared_model::validation::AlwaysValidValidator,
+        shared_model::proto::UnsignedWrapper<shared_model::proto::Block>>;
+    auto block = TestUnsignedBlockBuilder()
+                     .height(height)
+                     .prevHash(prev_hash)
+                     .createdTime(iroha::time::now())
+                     .transactions(transactions)
+                     .build();
+    for (size_t i = 0; i < signers; ++i) {
+      block.signAndAddSignature(keys[i]);
+    }
+    return std::make_shared<shared_model::proto::Block>(block.finish());
+  }
+
+  /**
+   * @return matcher of the peer with the key of given peer
+   */
+  auto peerOf(size_t peer) const {
+    return Property(&shared_model::interface::Peer::pubkey,
+                    peers[peer]->pubkey());
+  }
+
+  /**
+   * @return blocks as they are sent by the first peer
+   */
+  rxcpp::observable<LoadedBlock> loadedBlocks() const {
+    std::vector<LoadedBlock> loaded;
+    for (const auto &block : blocks) {
+      loaded.push_back({peers[0]->pubkey(), block});
+    }
+    return rxcpp::observable<>::iterate(loaded);
+  }
+
+  /**
+   * Checkpoint of the last block, which is returned by given peer
+   */
+  void expectCheckpoint(size_t peer,
+                        const shared_model::crypto::Hash &block_hash) {
+    EXPECT_CALL(*block_loader, retrieveCheckpoint(peerOf(peer)))
+        .WillOnce(Return(Checkpoint{{kHeight, {{"peer", {"{}"}}}},
+                                    block_hash,
+                                    peers[peer]->pubkey(),
+                                    shared_model::crypto::Signed("")}));
+  }
+
+  static constexpr size_t kPeers = 4;
+  static constexpr shared_model::interface::types::HeightType kHeight = 4;
+
+  std::vector<shared_model::crypto::Keypair> keys;
+  std::vector<wPeer> peers;
+  wBlock genesis;
+  std::vector<wBlock> blocks;
+
+  std::shared_ptr<MockBlockLoader> block_loader;
+  std::shared_ptr<MockStorage> storage;
+  std::shared_ptr<MockBlockQuery> block_query;
+  std::shared_ptr<MockPeerQuery> peer_query;
+  std::shared_ptr<FastSync> fast_sync;
+};
+
+constexpr size_t FastSyncTest::kPeers;
+constexpr shared_model::interface::types::HeightType FastSyncTest::kHeight;
+
+/**
+ * @given checkpoint of supermajority of the peers and the chain leading to it
+ * @when fast sync is run
+ * @then snapshot is loaded together with the blocks
+ */
+TEST_F(FastSyncTest, LoadsCheckpointOfSupermajority) {
+  for (size_t i = 0; i < kPeers; ++i) {
+    if (i + 1 < kPeers) {
+      expectCheckpoint(i, blocks.back()->hash());
+    } else {
+      EXPECT_CALL(*block_loader, retrieveCheckpoint(peerOf(i)))
+          .WillOnce(Return(boost::none));
+    }
+  }
+  EXPECT_CALL(*block_loader, retrieveBlocks(_, kHeight))
+      .WillOnce(Return(loadedBlocks()));
+  EXPECT_CALL(*storage,
+              loadSnapshot(Field(&WsvSnapshot::height, kHeight),
+                           SizeIs(blocks.size())))
+      .WillOnce(Return(true));
+
+  ASSERT_TRUE(fast_sync->run());
+}
+
+/**
+ * @given checkpoint signed by less than supermajority of the peers
+ * @when fast sync is run
+ * @then snapshot is not loaded
+ */
+TEST_F(FastSyncTest, IgnoresCheckpointWithoutSupermajority) {
+  for (size_t i = 0; i < kPeers; ++i) {
+    if (i < 2) {
+      expectCheckpoint(i, blocks.back()->hash());
+    } else {
+      EXPECT_CALL(*block_loader, retrieveCheckpoint(peerOf(i)))
+          .WillOnce(Return(boost::none));
+    }
+  }
+  EXPECT_CALL(*block_loader, retrieveBlocks(_, kHeight))
+      .WillOnce(Return(loadedBlocks()));
+  EXPECT_CALL(*storage, loadSnapshot(_, _)).Times(0);
+
+  ASSERT_FALSE(fast_sync->run());
+}
+
+/**
+ * @given checkpoint of supermajority which refers to unknown block
+ * @when fast sync is run
+ * @then snapshot is not loaded
+ */
+TEST_F(FastSyncTest, IgnoresCheckpointOfOtherChain) {
+  auto other_hash = shared_model::crypto::Hash(std::string(32, '1'));
+  for (size_t i = 0; i < kPeers; ++i) {
+    expectCheckpoint(i, other_hash);
+  }
+  EXPECT_CALL(*block_loader, retrieveBlocks(_, kHeight))
+      .WillOnce(Return(loadedBlocks()));
+  EXPECT_CALL(*storage, loadSnapshot(_, _)).Times(0);
+
+  ASSERT_FALSE(fast_sync->run());
+}
+
+/**
+ * @given local ledger with the only peer, which adds the rest of the peers in
+ * the next block
+ * AND checkpoint of the local peer and two added peers, which is supermajority
+ * of the peers at its height
+ * @when fast sync is run
+ * @then checkpoints are requested from the added peers as well
+ * AND snapshot is loaded
+ */
+TEST_F(FastSyncTest, LoadsCheckpointOfAddedPeers) {
+  EXPECT_CALL(*peer_query, getLedgerPeers())
+      .WillRepeatedly(Return(std::vector<wPeer>{peers[0]}));
+  std::vector<shared_model::proto::Transaction> add_peers;
+  for (size_t i = 1; i < kPeers; ++i) {
+    add_peers.push_back(
+        TestTransactionBuilder()
+            .addPeer(peers[i]->address(), peers[i]->pubkey())
+            .build());
+  }
+  blocks.clear();
+  blocks.push_back(makeBlock(2, genesis->hash(), 1, add_peers));
+  for (auto height = 3; height <= kHeight; ++height) {
+    blocks.push_back(makeBlock(height, blocks.back()->hash()));
+  }
+
+  for (size_t i = 0; i + 1 < kPeers; ++i) {
+    expectCheckpoint(i, blocks.back()->hash());
+  }
+  EXPECT_CALL(*block_loader, retrieveCheckpoint(peerOf(kPeers - 1)))
+      .WillOnce(Return(boost::none));
+  EXPECT_CALL(*block_loader, retrieveBlocks(_, kHeight))
+      .WillOnce(Return(loadedBlocks()));
+  EXPECT_CALL(*storage,
+              loadSnapshot(Field(&WsvSnapshot::height, kHeight),
+                           SizeIs(blocks.size())))
+      .WillOnce(Return(true));
+
+  ASSERT_TRUE(fast_sync->run());
+}
@@ -88,6 +88,15 @@ class SynchronizerTest : public ::testing::Test {
     return std::make_shared<shared_model::proto::Block>(std::move(block));
   }
 
+  /**
+   * @return block as it is sent by the peer
+   */
+  LoadedBlock loaded(std::shared_ptr<shared_model::interface::Block> block,
+                     const shared_model::crypto::PublicKey &peer =
+                         shared_model::crypto::PublicKey("peer")) const {
+    return LoadedBlock{peer, std::move(block)};
+  }
+
   std::shared_ptr<MockChainValidator> chain_validator;
   std::shared_ptr<MockMutableFactory> mutable_factory;
   std::shared_ptr<MockBlockLoader> block_loader;
@@ -124,7 +133,7 @@ TEST_F(SynchronizerTest, ValidWhenSingleCommitSynchronized) {
   EXPECT_CALL(*chain_validator, validateBlock(testing::Ref(*test_block), _))
       .WillOnce(Return(true));
 
-  EXPECT_CALL(*block_loader, retrieveBlocks(_)).Times(0);
+  EXPECT_CALL(*block_loader, retrieveBlocks(_, _)).Times(0);
 
   EXPECT_CALL(*consensus_gate, on_commit())
       .WillOnce(Return(
@@ -165,7 +174,7 @@ TEST_F(SynchronizerTest, ValidWhenBadStorage) {
 
   EXPECT_CALL(*chain_validator, validateBlock(_, _)).Times(0);
 
-  EXPECT_CALL(*block_loader, retrieveBlocks(_)).Times(0);
+  EXPECT_CALL(*block_loader, retrieveBlocks(_, _)).Times(0);
 
   EXPECT_CALL(*consensus_gate, on_commit())
       .WillOnce(Return(
@@ -199,10 +208,15 @@ TEST_F(SynchronizerTest, ValidWhenValidChain) {
   EXPECT_CALL(*chain_validator, validateBlock(testing::Ref(*commit_message), _))
       .WillOnce(Return(false));
 
-  EXPECT_CALL(*chain_validator, validateChain(_, _)).WillOnce(Return(true));
+  EXPECT_CALL(*chain_validator, validateChain(_, _))
+      .WillOnce(testing::Invoke([](auto chain, auto &) {
+        // emulate chain check
+        chain.as_blocking().subscribe([](auto) {});
+        return true;
+      }));
 
-  EXPECT_CALL(*block_loader, retrieveBlocks(_))
-      .WillOnce(Return(rxcpp::observable<>::just(commit_message)));
+  EXPECT_CALL(*block_loader, retrieveBlocks(_, _))
+      .WillOnce(Return(rxcpp::observable<>::just(loaded(commit_message))));
 
   EXPECT_CALL(*consensus_gate, on_commit())
       .WillOnce(Return(
@@ -243,11 +257,16 @@ TEST_F(SynchronizerTest, InvalidWhenUnexpectedEnd) {
   EXPECT_CALL(*chain_validator, validateBlock(testing::Ref(*commit_message), _))
       .WillOnce(Return(false));
 
-  EXPECT_CALL(*chain_validator, validateChain(_, _)).WillOnce(Return(true));
+  EXPECT_CALL(*chain_validator, validateChain(_, _))
+      .WillOnce(testing::Invoke([](auto chain, auto &) {
+        // emulate chain check
+        chain.as_blocking().subscribe([](auto) {});
+        return true;
+      }));
 
   // wrong block has different hash
-  EXPECT_CALL(*block_loader, retrieveBlocks(_))
-      .WillOnce(Return(rxcpp::observable<>::just(makeCommit(2))));
+  EXPECT_CALL(*block_loader, retrieveBlocks(_, _))
+      .WillOnce(Return(rxcpp::observable<>::just(loaded(makeCommit(2)))));
 
   EXPECT_CALL(*consensus_gate, on_commit())
       .WillOnce(Return(
@@ -285,16 +304,15 @@ TEST_F(SynchronizerTest, OnlyOneRetrieval) {
         chain.as_blocking().subscribe([](auto) {});
         return true;
       }));
-  EXPECT_CALL(*block_loader, retrieveBlocks(_))
-      .WillOnce(Return(rxcpp::observable<>::create<
-                       std::shared_ptr<shared_model::interface::Block>>(
-          [commit_message](auto s) {
+  EXPECT_CALL(*block_loader, retrieveBlocks(_, _))
+      .WillOnce(Return(rxcpp::observable<>::create<LoadedBlock>(
+          [this, commit_message](auto s) {
             static int times = 0;
             if (times++) {
               FAIL()
                   << "Observable of retrieveBlocks must be evaluated only once";
             }
-            s.on_next(commit_message);
+            s.on_next(loaded(commit_message));
             s.on_completed();
           })));
   init();
@@ -304,3 +322,65 @@ TEST_F(SynchronizerTest, OnlyOneRetrieval) {
   synchronizer->process_commit(commit_message);
   ASSERT_TRUE(wrapper.validate());
 }
+
+/**
+ * @given A commit signed by two peers, which cannot be applied directly
+ * @when the chain from one of the peers is rejected
+ * @then the chain is downloaded again from the other peer and committed
+ */
+TEST_F(SynchronizerTest, RetriesWithoutPeerOfRejectedBlock) {
+  using TestUnsignedBlockBuilder = shared_model::proto::TemplateBlockBuilder<
+      (1 << shared_model::proto::TemplateBlockBuilder<>::total) - 1,
+      shared_model::validation::AlwaysValidValidator,
+      shared_model::proto::UnsignedWrapper<shared_model::proto::Block>>;
+  auto bad_peer =
+      shared_model::crypto::DefaultCryptoAlgorithmType::generateKeypair();
+  auto good_peer =
+      shared_model::crypto::DefaultCryptoAlgorithmType::generateKeypair();
+  std::shared_ptr<shared_model::interface::Block> commit_message =
+      std::make_shared<shared_model::proto::Block>(
+          TestUnsignedBlockBuilder()
+              .height(5)
+              .createdTime(iroha::time::now())
+              .build()
+              .signAndAddSignature(bad_peer)
+              .signAndAddSignature(good_peer)
+              .finish());
+
+  DefaultValue<expected::Result<std::unique_ptr<MutableStorage>, std::string>>::
+      SetFactory(&createMockMutableStorage);
+  EXPECT_CALL(*mutable_factory, createMutableStorage()).Times(3);
+  EXPECT_CALL(*mutable_factory, commit_(_)).Times(1);
+  EXPECT_CALL(*consensus_gate, on_commit())
+      .WillOnce(Return(
+          rxcpp::observable<>::empty<shared_model::interface::BlockVariant>()));
+  EXPECT_CALL(*chain_validator, validateBlock(_, _)).WillOnce(Return(false));
+  EXPECT_CALL(*chain_validator, validateChain(_, _))
+      .WillOnce(testing::Invoke([](auto chain, auto &) {
+        chain.as_blocking().subscribe([](auto) {});
+        return false;
+      }))
+      .WillOnce(testing::Invoke([](auto chain, auto &) {
+        chain.as_blocking().subscribe([](auto) {});
+        return true;
+      }));
+  EXPECT_CALL(*block_loader,
+              retrieveBlocks(std::vector<shared_model::crypto::PublicKey>{
+                                 bad_peer.publicKey(), good_peer.publicKey()},
+                             _))
+      .WillOnce(Return(rxcpp::observable<>::just(
+          loaded(commit_message, bad_peer.publicKey()))));
+  EXPECT_CALL(*block_loader,
+              retrieveBlocks(std::vector<shared_model::crypto::PublicKey>{
+                                 good_peer.publicKey()},
+                             _))
+      .WillOnce(Return(rxcpp::observable<>::just(
+          loaded(commit_message, good_peer.publicKey()))));
+
+  init();
+  auto wrapper =
+      make_test_subscriber<CallExact>(synchronizer->on_commit_chain(), 1);
+  wrapper.subscribe();
+  synchronizer->process_commit(commit_message);
+  ASSERT_TRUE(wrapper.validate());
+}
@@ -41,6 +41,8 @@ class TransactionProcessorTest : public ::testing::Test {
         .WillRepeatedly(Return(commit_notifier.get_observable()));
     EXPECT_CALL(*pcs, on_verified_proposal())
         .WillRepeatedly(Return(verified_prop_notifier.get_observable()));
+    EXPECT_CALL(*pcs, on_rejection())
+        .WillRepeatedly(Return(rejection_notifier.get_observable()));
 
     EXPECT_CALL(*mp, onPreparedTransactionsImpl())
         .WillRepeatedly(Return(mst_prepared_notifier.get_observable()));
@@ -100,6 +102,8 @@ class TransactionProcessorTest : public ::testing::Test {
   rxcpp::subjects::subject<
       std::shared_ptr<iroha::validation::VerifiedProposalAndErrors>>
       verified_prop_notifier;
+  rxcpp::subjects::subject<iroha::network::OrderingRejection>
+      rejection_notifier;
 
   const size_t proposal_size = 5;
   const size_t block_size = 3;
@@ -460,3 +464,29 @@ TEST_F(TransactionProcessorTest, MultisigExpired) {
   tp->transactionHandle(tx);
   mst_expired_notifier.get_subscriber().on_next(tx);
 }
+
+/**
+ * @given transaction processor
+ * @when ordering service rejects transactions because of overload
+ * @then ORDERING_REJECTED status is published for every rejected transaction
+ */
+TEST_F(TransactionProcessorTest, OrderingRejected) {
+  std::vector<shared_model::crypto::Hash> hashes = {
+      shared_model::crypto::Hash(std::string(32, '1')),
+      shared_model::crypto::Hash(std::string(32, '2'))};
+
+  std::vector<shared_model::crypto::Hash> published;
+  EXPECT_CALL(*status_bus, publish(_))
+      .Times(2)
+      .WillRepeatedly(testing::Invoke([&published](auto response) {
+        ASSERT_NO_THROW(boost::apply_visitor(
+            framework::SpecifiedVisitor<
+                shared_model::interface::OrderingRejectedResponse>(),
+            response->get()));
+        published.push_back(response->transactionHash());
+      }));
+
+  rejection_notifier.get_subscriber().on_next(
+      iroha::network::OrderingRejection{hashes, 100});
+  ASSERT_EQ(hashes, published);
+}
@@ -81,6 +81,11 @@ class CustomPeerCommunicationServiceMock : public PeerCommunicationService {
     return verified_prop_notifier_.get_observable();
   };
 
+  rxcpp::observable<iroha::network::OrderingRejection> on_rejection()
+      const override {
+    return rejection_notifier_.get_observable();
+  }
+
  private:
   rxcpp::subjects::subject<std::shared_ptr<shared_model::interface::Proposal>>
       prop_notifier_;
@@ -88,6 +93,8 @@ class CustomPeerCommunicationServiceMock : public PeerCommunicationService {
   rxcpp::subjects::subject<
       std::shared_ptr<iroha::validation::VerifiedProposalAndErrors>>
       verified_prop_notifier_;
+  rxcpp::subjects::subject<iroha::network::OrderingRejection>
+      rejection_notifier_;
 };
 
 class ToriiServiceTest : public testing::Test {
@@ -0,0 +1,68 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <gtest/gtest.h>
+
+#include "cache/expiring_set.hpp"
+
+using namespace iroha::cache;
+using namespace std::chrono_literals;
+
+class ExpiringSetTest : public testing::Test {
+ public:
+  ExpiringSet<std::string> set{10s};
+  ExpiringSet<std::string>::Clock::time_point start =
+      ExpiringSet<std::string>::Clock::now();
+};
+
+/**
+ * @given empty set
+ * @when the same key is inserted twice within the window
+ * @then only the first insertion succeeds
+ */
+TEST_F(ExpiringSetTest, RejectsKeyWithinWindow) {
+  ASSERT_TRUE(set.insert("a", start));
+  ASSERT_FALSE(set.insert("a", start + 5s));
+  ASSERT_TRUE(set.insert("b", start + 5s));
+  ASSERT_EQ(2, set.size());
+}
+
+/**
+ * @given set with a key
+ * @when the window passes
+ * @then the key is forgotten and can be inserted again
+ */
+TEST_F(ExpiringSetTest, ForgetsKeyAfterWindow) {
+  set.insert("a", start);
+
+  ASSERT_FALSE(set.contains("a", start + 10s));
+  ASSERT_TRUE(set.insert("a", start + 10s));
+}
+
+/**
+ * @given set with a key
+ * @when the key is touched in the middle of the window
+ * @then the key is kept for the whole window since touch
+ */
+TEST_F(ExpiringSetTest, TouchProlongsKey) {
+  set.insert("a", start);
+  set.touch("a", start + 5s);
+
+  ASSERT_TRUE(set.contains("a", start + 12s));
+  ASSERT_FALSE(set.contains("a", start + 15s));
+}
+
+/**
+ * @given set with a key
+ * @when the key is erased
+ * @then it can be inserted again within the window
+ */
+TEST_F(ExpiringSetTest, ErasedKeyCanBeInserted) {
+  set.insert("a", start);
+  set.erase("a");
+
+  ASSERT_TRUE(set.insert("a", start + 1s));
+  ASSERT_TRUE(set.contains("a", start + 10s));
+}
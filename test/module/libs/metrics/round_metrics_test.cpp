@@ -0,0 +1,99 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <gtest/gtest.h>
+
+#include <rapidjson/document.h>
+
+#include "metrics/round_metrics.hpp"
+
+using namespace iroha::metrics;
+using namespace std::chrono_literals;
+
+/**
+ * @given round metrics
+ * @when phases of rounds are recorded
+ * @then histograms aggregate all durations
+ * @and durations of repeated phase of a round are summed up
+ */
+TEST(RoundMetricsTest, PhasesAreAggregated) {
+  RoundMetrics metrics;
+  metrics.record(Phase::kValidation, 1, 3us);
+  metrics.record(Phase::kValidation, 2, 100us);
+  metrics.record(Phase::kValidation, 2, 20us);
+
+  auto histogram = metrics.histogram(Phase::kValidation);
+  EXPECT_EQ(histogram.count, 3);
+  EXPECT_EQ(histogram.sum_us, 123);
+  EXPECT_EQ(histogram.max_us, 100);
+  // 3 is in [2, 4), 20 is in [16, 32), 100 is in [64, 128)
+  EXPECT_EQ(histogram.buckets[2], 1);
+  EXPECT_EQ(histogram.buckets[5], 1);
+  EXPECT_EQ(histogram.buckets[7], 1);
+  EXPECT_EQ(metrics.histogram(Phase::kCommit).count, 0);
+
+  auto round = metrics.round(2);
+  ASSERT_TRUE(round);
+  EXPECT_EQ(round->at(static_cast<size_t>(Phase::kValidation)), 120);
+  EXPECT_EQ(round->at(static_cast<size_t>(Phase::kCommit)), 0);
+}
+
+/**
+ * @given round metrics which retain two rounds
+ * @when three rounds are recorded
+ * @then the oldest round is dropped, while histogram keeps its duration
+ */
+TEST(RoundMetricsTest, OldRoundsAreDropped) {
+  RoundMetrics metrics(2);
+  metrics.record(Phase::kCommit, 1, 1us);
+  metrics.record(Phase::kCommit, 2, 1us);
+  metrics.record(Phase::kCommit, 3, 1us);
+
+  EXPECT_FALSE(metrics.round(1));
+  EXPECT_TRUE(metrics.round(2));
+  EXPECT_TRUE(metrics.round(3));
+  EXPECT_EQ(metrics.histogram(Phase::kCommit).count, 3);
+}
+
+/**
+ * @given timers of a phase
+ * @when one of them is stopped and the other is cancelled
+ * @then only the duration of the stopped timer is recorded
+ */
+TEST(RoundMetricsTest, CancelledPhaseIsNotRecorded) {
+  auto count = roundMetrics().histogram(Phase::kSigning).count;
+  {
+    PhaseTimer timer(Phase::kSigning, 1);
+    timer.cancel();
+  }
+  EXPECT_EQ(roundMetrics().histogram(Phase::kSigning).count, count);
+
+  {
+    PhaseTimer timer(Phase::kSigning, 1);
+    timer.stop();
+    timer.cancel();
+  }
+  EXPECT_EQ(roundMetrics().histogram(Phase::kSigning).count, count + 1);
+}
+
+/**
+ * @given round metrics with recorded phase
+ * @when metrics are dumped
+ * @then dump is JSON with histogram of each phase and recorded rounds
+ */
+TEST(RoundMetricsTest, DumpIsJson) {
+  RoundMetrics metrics;
+  metrics.record(Phase::kVote, 5, 10us);
+
+  rapidjson::Document dump;
+  dump.Parse(metrics.toJson().c_str());
+  ASSERT_FALSE(dump.HasParseError());
+  ASSERT_TRUE(dump["phases"].IsObject());
+  EXPECT_EQ(dump["phases"].MemberCount(), kPhases);
+  EXPECT_EQ(dump["phases"]["vote"]["count"].GetUint64(), 1);
+  ASSERT_EQ(dump["rounds"].Size(), 1);
+  EXPECT_EQ(dump["rounds"][0]["height"].GetUint64(), 5);
+  EXPECT_EQ(dump["rounds"][0]["vote"].GetUint64(), 10);
+}
@@ -0,0 +1,66 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <gtest/gtest.h>
+
+#include <future>
+
+#include "timer/timer_wheel.hpp"
+
+using namespace iroha::timer;
+using namespace std::chrono_literals;
+
+class TimerWheelTest : public ::testing::Test {
+ public:
+  TimerWheel wheel;
+};
+
+/**
+ * @given timer wheel
+ * @when callbacks are scheduled with delays in reverse order
+ * @then they are invoked in order of expiration not before their delays
+ */
+TEST_F(TimerWheelTest, InvokesInOrderOfExpiration) {
+  std::mutex mutex;
+  std::vector<int> invoked;
+  std::promise<void> done;
+  auto start = TimerWheel::Clock::now();
+
+  // second delay crosses the first level of the wheel
+  wheel.schedule(150ms, [&] {
+    std::lock_guard<std::mutex> lock(mutex);
+    invoked.push_back(150);
+    EXPECT_GE(TimerWheel::Clock::now() - start, 150ms);
+    done.set_value();
+  });
+  wheel.schedule(20ms, [&] {
+    std::lock_guard<std::mutex> lock(mutex);
+    invoked.push_back(20);
+    EXPECT_GE(TimerWheel::Clock::now() - start, 20ms);
+  });
+
+  ASSERT_EQ(std::future_status::ready,
+            done.get_future().wait_for(std::chrono::seconds(5)));
+  std::lock_guard<std::mutex> lock(mutex);
+  ASSERT_EQ(std::vector<int>({20, 150}), invoked);
+}
+
+/**
+ * @given timer wheel with two scheduled callbacks
+ * @when one of them is cancelled
+ * @then only the other one is invoked
+ */
+TEST_F(TimerWheelTest, CancelledCallbackIsNotInvoked) {
+  std::atomic<bool> cancelled_invoked{false};
+  std::promise<void> done;
+
+  auto handle = wheel.schedule(10ms, [&] { cancelled_invoked = true; });
+  wheel.schedule(30ms, [&] { done.set_value(); });
+  handle.cancel();
+
+  ASSERT_EQ(std::future_status::ready,
+            done.get_future().wait_for(std::chrono::seconds(5)));
+  ASSERT_FALSE(cancelled_invoked);
+}
@@ -0,0 +1,69 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "backend/protobuf/block.hpp"
+
+#include <gtest/gtest.h>
+
+class ProtoBlockTest : public ::testing::Test {
+ public:
+  void SetUp() override {
+    arena = std::make_shared<google::protobuf::Arena>();
+    transport =
+        google::protobuf::Arena::CreateMessage<iroha::protocol::Block>(
+            arena.get());
+    transport->mutable_payload()->set_height(height);
+    for (size_t i = 0; i < txs_number; ++i) {
+      transport->mutable_payload()
+          ->add_transactions()
+          ->mutable_payload()
+          ->mutable_reduced_payload()
+          ->set_creator_account_id(creator);
+    }
+  }
+
+  const shared_model::interface::types::HeightType height = 5;
+  const size_t txs_number = 3;
+  const std::string creator = "admin@test";
+
+  std::shared_ptr<google::protobuf::Arena> arena;
+  iroha::protocol::Block *transport;
+};
+
+/**
+ * @given block transport allocated in the arena
+ * @when block is created from the transport
+ * @then block refers to the transport without copying it
+ */
+TEST_F(ProtoBlockTest, ArenaTransportIsNotCopied) {
+  shared_model::proto::Block block(arena, *transport);
+
+  ASSERT_EQ(transport, &block.getTransport());
+  ASSERT_EQ(height, block.height());
+  ASSERT_EQ(txs_number, boost::size(block.transactions()));
+  ASSERT_EQ(creator, block.transactions()[0].creatorAccountId());
+}
+
+/**
+ * @given block created from the arena transport
+ * @when block is moved
+ * @then new block refers to the same transport and old one does not
+ */
+TEST_F(ProtoBlockTest, MoveKeepsArenaTransport) {
+  shared_model::proto::Block block(std::move(arena), *transport);
+  shared_model::proto::Block moved(std::move(block));
+
+  ASSERT_EQ(transport, &moved.getTransport());
+  ASSERT_NE(transport, &block.getTransport());
+  ASSERT_EQ(txs_number, boost::size(moved.transactions()));
+
+  iroha::protocol::Block heap_transport;
+  shared_model::proto::Block assigned(heap_transport);
+  assigned = std::move(moved);
+
+  ASSERT_EQ(transport, &assigned.getTransport());
+  ASSERT_EQ(height, assigned.height());
+  ASSERT_EQ(txs_number, boost::size(assigned.transactions()));
+}
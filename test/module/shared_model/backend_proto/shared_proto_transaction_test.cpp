@@ -114,3 +114,31 @@ TEST(ProtoTransaction, BuilderWithInvalidTx) {
                    .build(),
                std::invalid_argument);
 }
+
+/**
+ * @given transaction built from protobuf transport with command and signature
+ * @when commands and signatures of the transaction are accessed
+ * @then they refer to the transport messages instead of copies
+ */
+TEST(ProtoTransaction, RangesReferToTransport) {
+  iroha::protocol::Transaction proto_tx = generateEmptyTransaction();
+  proto_tx.mutable_payload()
+      ->mutable_reduced_payload()
+      ->add_commands()
+      ->mutable_add_asset_quantity()
+      ->CopyFrom(generateAddAssetQuantity("coin#test"));
+  auto sig = proto_tx.add_signatures();
+  sig->set_pubkey(std::string(32, '1'));
+  sig->set_signature(std::string(64, '2'));
+
+  shared_model::proto::Transaction tx(proto_tx);
+
+  const auto &command = static_cast<const shared_model::proto::Command &>(
+      *tx.commands().begin());
+  ASSERT_EQ(&proto_tx.payload().reduced_payload().commands(0),
+            &command.getTransport());
+
+  const auto &signature = static_cast<const shared_model::proto::Signature &>(
+      *tx.signatures().begin());
+  ASSERT_EQ(&proto_tx.signatures(0), &signature.getTransport());
+}
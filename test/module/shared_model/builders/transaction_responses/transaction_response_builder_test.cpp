@@ -53,6 +53,9 @@ using TransactionResponsTypes =
                      TransactionResponseBuilderTestCase<
                          shared_model::interface::MstExpiredResponse,
                          &BuilderType::mstExpired>,
+                     TransactionResponseBuilderTestCase<
+                         shared_model::interface::OrderingRejectedResponse,
+                         &BuilderType::orderingRejected>,
                      TransactionResponseBuilderTestCase<
                          shared_model::interface::NotReceivedTxResponse,
                          &BuilderType::notReceived> >;
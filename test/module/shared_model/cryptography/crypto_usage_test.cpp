@@ -206,3 +206,33 @@ TEST_F(CryptoUsageTest, SignAndVerifyTransactionkWithWrongSignature) {
 
   ASSERT_FALSE(verify(*transaction));
 }
+
+/**
+ * @given batch of correct signatures with one incorrect signature among them
+ * @when verify the batch
+ * @then only the incorrect signature is reported as invalid
+ */
+TEST_F(CryptoUsageTest, VerifyBatchWithWrongSignature) {
+  auto correct = DefaultCryptoAlgorithmType::sign(data, keypair);
+  auto wrong = DefaultCryptoAlgorithmType::sign(Blob("wrong payload"), keypair);
+
+  // enough items to split verification between several workers
+  const size_t batch_size = 100;
+  const size_t wrong_index = 42;
+  VerificationBatch batch;
+  for (size_t i = 0; i < batch_size; ++i) {
+    batch.push_back(
+        {i == wrong_index ? wrong : correct, data, keypair.publicKey()});
+  }
+
+  auto results = CryptoVerifier<>::verifyBatch(batch);
+  ASSERT_EQ(batch_size, results.size());
+  for (size_t i = 0; i < batch_size; ++i) {
+    ASSERT_EQ(i != wrong_index, results[i]);
+  }
+  ASSERT_FALSE(CryptoVerifier<>::verifyAll(batch));
+
+  VerificationBatch correct_batch(batch_size,
+                                  {correct, data, keypair.publicKey()});
+  ASSERT_TRUE(CryptoVerifier<>::verifyAll(correct_batch));
+}
@@ -16,7 +16,10 @@
  */
 
 #include <gtest/gtest.h>
+#include <atomic>
 #include <string>
+#include <thread>
+#include <vector>
 #include "utils/lazy_initializer.hpp"
 
 struct SourceValue {
@@ -57,3 +60,32 @@ TEST(LazyTest, CheckLaziness) {
   ASSERT_EQ("100500", lazy->target);
   ASSERT_EQ(1, call_counter);
 }
+
+/**
+ * @given Initialized value
+ * @when Call get from several threads simultaneously
+ * @then Assert that transform invoked once and all threads got the same value
+ */
+TEST(LazyTest, ConcurrentAccess) {
+  SourceValue v{100500};
+  std::atomic<int> call_counter{0};
+  auto lazy = shared_model::detail::makeLazyInitializer([&call_counter, &v] {
+    call_counter++;
+    return TargetValue{std::to_string(v.val)};
+  });
+
+  const size_t threads_number = 8;
+  std::vector<const TargetValue *> results(threads_number);
+  std::vector<std::thread> threads;
+  for (size_t i = 0; i < threads_number; ++i) {
+    threads.emplace_back([&lazy, &results, i] { results[i] = lazy.ptr(); });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+
+  ASSERT_EQ(1, call_counter);
+  for (const auto result : results) {
+    ASSERT_EQ(lazy.ptr(), result);
+  }
+}
@@ -780,3 +780,99 @@ TEST_F(FieldValidatorTest, QueryContainerFieldsValidation) {
       },
       [] {});
 }
+
+/**
+ * Fixture for the cache of verified signatures, shared by all validators
+ */
+class SignatureCacheTest : public ::testing::Test {
+ public:
+  /**
+   * @param result - result of verification of every signature
+   * @return validator which counts signatures passed to verification
+   */
+  validation::FieldValidator makeValidator(bool result) {
+    return validation::FieldValidator(
+        validation::FieldValidator::kDefaultFutureGap,
+        [] { return iroha::time::now(); },
+        [this, result](const crypto::VerificationBatch &batch) {
+          verified += batch.size();
+          return crypto::VerificationResults(batch.size(), result);
+        });
+  }
+
+  /**
+   * @return transaction signed with a new key, so its signature was not
+   * cached by other tests
+   */
+  proto::Transaction makeTx() {
+    return proto::TransactionBuilder()
+        .creatorAccountId("some@account")
+        .createdTime(iroha::time::now())
+        .setAccountQuorum("some@account", 2)
+        .quorum(1)
+        .build()
+        .signAndAddSignature(
+            crypto::DefaultCryptoAlgorithmType::generateKeypair())
+        .finish();
+  }
+
+  /**
+   * @return reasons of validation of signatures of the transaction over the
+   * source
+   */
+  validation::ReasonsGroupType validate(
+      const validation::FieldValidator &validator,
+      const proto::Transaction &tx,
+      const crypto::Blob &source) {
+    validation::ReasonsGroupType reason;
+    validator.validateSignatures(reason, tx.signatures(), source);
+    return reason;
+  }
+
+  size_t verified = 0;
+};
+
+/**
+ * @given signature which was verified
+ * @when it is validated again by another validator
+ * @then it is not verified again
+ */
+TEST_F(SignatureCacheTest, HitSkipsVerification) {
+  auto tx = makeTx();
+
+  ASSERT_TRUE(validate(makeValidator(true), tx, tx.payload()).second.empty());
+  ASSERT_EQ(1, verified);
+
+  ASSERT_TRUE(validate(makeValidator(true), tx, tx.payload()).second.empty());
+  ASSERT_EQ(1, verified);
+}
+
+/**
+ * @given signature which failed verification
+ * @when it is validated again
+ * @then it is verified again
+ */
+TEST_F(SignatureCacheTest, FailureIsNotCached) {
+  auto tx = makeTx();
+
+  ASSERT_FALSE(validate(makeValidator(false), tx, tx.payload()).second.empty());
+  ASSERT_EQ(1, verified);
+
+  ASSERT_TRUE(validate(makeValidator(true), tx, tx.payload()).second.empty());
+  ASSERT_EQ(2, verified);
+}
+
+/**
+ * @given signature which was verified over the payload
+ * @when the same signature is validated over another payload
+ * @then it is verified, and the failure is reported
+ */
+TEST_F(SignatureCacheTest, ChangedPayloadIsNotHit) {
+  auto tx = makeTx();
+  ASSERT_TRUE(validate(makeValidator(true), tx, tx.payload()).second.empty());
+
+  auto changed = makeTx();
+  ASSERT_FALSE(
+      validate(makeValidator(false), tx, changed.payload()).second.empty());
+  ASSERT_EQ(2, verified);
+}